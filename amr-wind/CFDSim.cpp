@@ -4,6 +4,7 @@
 #include "amr-wind/utilities/PostProcessing.H"
 #include "amr-wind/overset/OversetManager.H"
 #include "amr-wind/core/ExtSolver.H"
+#include "amr-wind/core/VelocityGradient.H"
 #include "amr-wind/wind_energy/ABL.H"
 
 #include "AMReX_ParmParse.H"
@@ -18,6 +19,7 @@ CFDSim::CFDSim(amrex::AmrCore& mesh)
     , m_post_mgr(new PostProcessManager(*this))
     , m_ext_solver_mgr(new ExtSolverMgr)
     , m_helics(new helics_storage(*this))
+    , m_vel_grad(new VelocityGradient(*this))
 {}
 
 CFDSim::~CFDSim() = default;
@@ -23,7 +23,7 @@ void godunov::compute_fluxes(
     BCRec const* pbc,
     int const* iconserv,
     Real* p,
-    Vector<amrex::Geometry> geom,
+    const Vector<amrex::Geometry>& geom,
     Real dt,
     godunov::scheme godunov_scheme)
 {
@@ -576,3 +576,49 @@ void godunov::compute_fluxes(
             }
         });
 }
+
+void godunov::compute_fluxes_blocked(
+    int lev,
+    Box const& bx,
+    int ncomp,
+    Array4<Real> const& fx,
+    Array4<Real> const& fy,
+    Array4<Real> const& fz,
+    Array4<Real const> const& q,
+    Array4<Real const> const& umac,
+    Array4<Real const> const& vmac,
+    Array4<Real const> const& wmac,
+    Array4<Real const> const& fq,
+    BCRec const* pbc,
+    int const* iconserv,
+    const Vector<amrex::Geometry>& geom,
+    Real dt,
+    godunov::scheme godunov_scheme,
+    const IntVect& tile_size)
+{
+    BL_PROFILE("amr-wind::godunov::compute_fluxes_blocked");
+    AMREX_ALWAYS_ASSERT(tile_size.allGT(0));
+
+    // Scratch space for the largest tile, reused for every tile
+    const Box max_tile(IntVect(0), tile_size - 1);
+    FArrayBox tmpfab(
+        amrex::grow(max_tile, 1), ncomp * flux_scratch_comps,
+        The_Async_Arena());
+
+    // Faces shared by neighboring tiles are computed by both tiles with
+    // identical results
+    const auto lo = amrex::lbound(bx);
+    const auto hi = amrex::ubound(bx);
+    for (int kt = lo.z; kt <= hi.z; kt += tile_size[2]) {
+        for (int jt = lo.y; jt <= hi.y; jt += tile_size[1]) {
+            for (int it = lo.x; it <= hi.x; it += tile_size[0]) {
+                const IntVect tlo(it, jt, kt);
+                const Box tile(
+                    tlo, amrex::min(tlo + tile_size - 1, bx.bigEnd()));
+                compute_fluxes(
+                    lev, tile, ncomp, fx, fy, fz, q, umac, vmac, wmac, fq, pbc,
+                    iconserv, tmpfab.dataPtr(), geom, dt, godunov_scheme);
+            }
+        }
+    }
+}
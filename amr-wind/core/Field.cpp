@@ -5,6 +5,7 @@
 #include "amr-wind/core/FieldFillPatchOps.H"
 #include "amr-wind/core/FieldBCOps.H"
 #include "amr-wind/core/SimTime.H"
+#include "amr-wind/utilities/PerfReport.H"
 #include "amr-wind/boundary_conditions/BCInterface.H"
 
 namespace amr_wind {
@@ -130,6 +131,7 @@ const Field& Field::state(const FieldState fstate) const
 amrex::MultiFab& Field::operator()(int lev) noexcept
 {
     BL_ASSERT(lev < m_repo.num_active_levels());
+    mark_modified();
     return m_repo.get_multifab(m_id, lev);
 }
 
@@ -141,6 +143,7 @@ const amrex::MultiFab& Field::operator()(int lev) const noexcept
 
 amrex::Vector<amrex::MultiFab*> Field::vec_ptrs() noexcept
 {
+    mark_modified();
     const int nlevels = m_repo.num_active_levels();
     amrex::Vector<amrex::MultiFab*> ret;
     ret.reserve(nlevels);
@@ -169,6 +172,7 @@ void Field::fillpatch(
     const amrex::IntVect& nghost) noexcept
 {
     BL_PROFILE("amr-wind::Field::fillpatch 2");
+    perf::ScopedTimer perf_timer(perf::Region::fillpatch);
     BL_ASSERT(m_info->m_fillpatch_op);
     BL_ASSERT(m_info->bc_initialized() && m_info->m_bc_copied_to_device);
     auto& fop = *(m_info->m_fillpatch_op);
@@ -183,6 +187,7 @@ void Field::fillpatch_from_coarse(
     const amrex::IntVect& nghost) noexcept
 {
     BL_PROFILE("amr-wind::Field::fillpatch_from_coarse");
+    perf::ScopedTimer perf_timer(perf::Region::fillpatch);
     BL_ASSERT(m_info->m_fillpatch_op);
     BL_ASSERT(m_info->bc_initialized() && m_info->m_bc_copied_to_device);
     auto& fop = *(m_info->m_fillpatch_op);
@@ -193,9 +198,11 @@ void Field::fillpatch_from_coarse(
 void Field::fillpatch(amrex::Real time, amrex::IntVect ng) noexcept
 {
     BL_PROFILE("amr-wind::Field::fillpatch");
+    perf::ScopedTimer perf_timer(perf::Region::fillpatch);
     BL_ASSERT(m_info->m_fillpatch_op);
     BL_ASSERT(m_info->bc_initialized() && m_info->m_bc_copied_to_device);
     auto& fop = *(m_info->m_fillpatch_op);
+    mark_modified();
     const int nlevels = m_repo.num_active_levels();
     for (int lev = 0; lev < nlevels; ++lev) {
         fop.fillpatch(
@@ -214,6 +221,7 @@ void Field::fillpatch_sibling_fields(
     amrex::Array<Field*, AMREX_SPACEDIM>& fields) const noexcept
 {
     BL_PROFILE("amr-wind::Field::fillpatch array");
+    perf::ScopedTimer perf_timer(perf::Region::fillpatch);
     BL_ASSERT(m_info->m_fillpatch_op);
     BL_ASSERT(m_info->bc_initialized() && m_info->m_bc_copied_to_device);
     BL_ASSERT(m_info->m_ncomp == static_cast<int>(fields.size()));
@@ -253,6 +261,7 @@ void Field::fillphysbc(amrex::Real time, amrex::IntVect ng) noexcept
     BL_ASSERT(m_info->m_fillpatch_op);
     BL_ASSERT(m_info->bc_initialized() && m_info->m_bc_copied_to_device);
     auto& fop = *(m_info->m_fillpatch_op);
+    mark_modified();
     const int nlevels = m_repo.num_active_levels();
     for (int lev = 0; lev < nlevels; ++lev) {
         fop.fillphysbc(
@@ -16,6 +16,10 @@ void FieldRepo::make_new_level_from_scratch(
     const amrex::DistributionMapping& dm)
 {
     BL_PROFILE("amr-wind::FieldRepo::make_new_level_from_scratch");
+    m_scratch_pool->invalidate();
+    for (auto& field : m_field_vec) {
+        field->mark_modified();
+    }
     m_leveldata[lev] = std::make_unique<LevelDataHolder>();
 
     allocate_field_data(
@@ -33,6 +37,10 @@ void FieldRepo::make_new_level_from_coarse(
     const amrex::DistributionMapping& dm)
 {
     BL_PROFILE("amr-wind::FieldRepo::make_level_from_coarse");
+    m_scratch_pool->invalidate();
+    for (auto& field : m_field_vec) {
+        field->mark_modified();
+    }
     std::unique_ptr<LevelDataHolder> ldata(new LevelDataHolder());
 
     allocate_field_data(ba, dm, *ldata, *(ldata->m_factory));
@@ -57,6 +65,10 @@ void FieldRepo::remake_level(
     const amrex::DistributionMapping& dm)
 {
     BL_PROFILE("amr-wind::FieldRepo::remake_level");
+    m_scratch_pool->invalidate();
+    for (auto& field : m_field_vec) {
+        field->mark_modified();
+    }
     std::unique_ptr<LevelDataHolder> ldata(new LevelDataHolder());
 
     allocate_field_data(ba, dm, *ldata, *(ldata->m_factory));
@@ -77,6 +89,7 @@ void FieldRepo::remake_level(
 void FieldRepo::clear_level(int lev)
 {
     BL_PROFILE("amr-wind::FieldRepo::clear_level");
+    m_scratch_pool->invalidate();
     m_leveldata[lev].reset();
 }
 
@@ -314,14 +327,29 @@ std::unique_ptr<ScratchField> FieldRepo::create_scratch_field(
     std::unique_ptr<ScratchField> field(
         new ScratchField(*this, name, ncomp, nghost, floc));
 
-    for (int lev = 0; lev <= m_mesh.finestLevel(); ++lev) {
-        const auto ba =
+    const int nlevels = m_mesh.finestLevel() + 1;
+    amrex::Vector<amrex::BoxArray> ba(nlevels);
+    amrex::Vector<amrex::DistributionMapping> dm(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        ba[lev] =
             amrex::convert(m_mesh.boxArray(lev), field_impl::index_type(floc));
+        dm[lev] = m_mesh.DistributionMap(lev);
+    }
 
-        field->m_data.emplace_back(
-            ba, m_mesh.DistributionMap(lev), ncomp, nghost, amrex::MFInfo(),
-            *(m_leveldata[lev]->m_factory));
+    // Reuse data released by an earlier scratch field with the same layout
+    field->m_data = m_scratch_pool->acquire(
+        ncomp, field->num_grow(), floc, ba, dm);
+    if (field->m_data.empty()) {
+        for (int lev = 0; lev < nlevels; ++lev) {
+            field->m_data.emplace_back(
+                ba[lev], dm[lev], ncomp, nghost, amrex::MFInfo(),
+                *(m_leveldata[lev]->m_factory));
+        }
     }
+
+    m_scratch_pool->checkout(field->m_data);
+    field->m_pool = m_scratch_pool;
+    field->m_pool_generation = m_scratch_pool->generation();
     return field;
 }
 
@@ -0,0 +1,158 @@
+#include "amr-wind/core/LoadBalancer.H"
+#include "amr-wind/CFDSim.H"
+
+#include "AMReX_ParmParse.H"
+#include "AMReX_Reduce.H"
+
+namespace amr_wind {
+
+LoadBalancer::LoadBalancer(CFDSim& sim) : m_sim(sim)
+{
+    amrex::ParmParse pp("loadbalance");
+    pp.query("enable", m_enabled);
+    pp.query("strategy", m_strategy);
+    pp.query("cell_weight", m_cell_weight);
+    pp.query("min_improvement", m_min_improvement);
+    pp.query("interval", m_interval);
+    pp.query("verbose", m_verbose);
+
+    if ((m_strategy != "knapsack") && (m_strategy != "sfc")) {
+        amrex::Abort("LoadBalancer: Invalid strategy: " + m_strategy);
+    }
+    AMREX_ALWAYS_ASSERT(m_cell_weight > 0.0);
+}
+
+void LoadBalancer::compute_cost(int lev, amrex::MultiFab& cost) const
+{
+    cost.setVal(m_cell_weight);
+    for (const auto& pp : m_sim.physics()) {
+        pp->add_load_balance_cost(lev, cost);
+    }
+}
+
+amrex::Vector<amrex::Real>
+LoadBalancer::box_costs(int lev, const amrex::BoxArray& ba) const
+{
+    BL_PROFILE("amr-wind::LoadBalancer::box_costs");
+    const auto& mesh = m_sim.mesh();
+    const int nboxes = static_cast<int>(ba.size());
+    amrex::Vector<amrex::Real> costs(nboxes, 0.0);
+
+    // Estimate the cost from the current data on this level, or from the
+    // coarser level if this level does not exist yet
+    const int nlevels = m_sim.repo().num_active_levels();
+    const int src_lev = (lev < nlevels) ? lev : lev - 1;
+    if ((src_lev < 0) || (src_lev >= nlevels)) {
+        for (int i = 0; i < nboxes; ++i) {
+            costs[i] = m_cell_weight * static_cast<amrex::Real>(ba[i].numPts());
+        }
+        return costs;
+    }
+
+    amrex::MultiFab cost(
+        mesh.boxArray(src_lev), mesh.DistributionMap(src_lev), 1, 0);
+    compute_cost(src_lev, cost);
+
+    // Cost of a source cell is attributed to all target cells it covers
+    amrex::IntVect ratio(1);
+    amrex::BoxArray ba_src(ba);
+    if (src_lev < lev) {
+        ratio = mesh.refRatio(src_lev);
+        ba_src.coarsen(ratio);
+    }
+    const amrex::Real nfine = static_cast<amrex::Real>(AMREX_D_TERM(
+        ratio[0], *ratio[1], *ratio[2]));
+
+    // Cells not covered by the current grids only get the cell weight
+    amrex::MultiFab tgt(ba_src, amrex::DistributionMapping(ba_src), 1, 0);
+    tgt.setVal(m_cell_weight);
+    tgt.ParallelCopy(cost, 0, 0, 1);
+
+    for (amrex::MFIter mfi(tgt); mfi.isValid(); ++mfi) {
+        const auto& bx = mfi.validbox();
+        const auto& carr = tgt.const_array(mfi);
+        amrex::ReduceOps<amrex::ReduceOpSum> reduce_op;
+        amrex::ReduceData<amrex::Real> reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
+        reduce_op.eval(
+            bx, reduce_data,
+            [=] AMREX_GPU_HOST_DEVICE(int i, int j, int k) -> ReduceTuple {
+                return {carr(i, j, k)};
+            });
+        costs[mfi.index()] = nfine * amrex::get<0>(reduce_data.value());
+    }
+    amrex::ParallelDescriptor::ReduceRealSum(costs.data(), nboxes);
+    return costs;
+}
+
+amrex::DistributionMapping LoadBalancer::make_distribution_map(
+    int lev, const amrex::BoxArray& ba) const
+{
+    BL_PROFILE("amr-wind::LoadBalancer::make_distribution_map");
+    const auto costs = box_costs(lev, ba);
+    amrex::Real eff = 0.0;
+    amrex::DistributionMapping dm;
+    if (m_strategy == "sfc") {
+        dm = amrex::DistributionMapping::makeSFC(costs, ba, eff);
+    } else {
+        dm = amrex::DistributionMapping::makeKnapSack(costs, eff);
+    }
+
+    if (m_verbose > 0) {
+        amrex::Print() << "LoadBalancer: level " << lev << " with "
+                       << ba.size() << " boxes, estimated efficiency = "
+                       << eff << std::endl;
+    }
+    return dm;
+}
+
+bool LoadBalancer::rebalance_due(int time_index) const
+{
+    return m_enabled && (m_interval > 0) && (time_index > 0) &&
+           (time_index % m_interval == 0);
+}
+
+bool LoadBalancer::rebalance(int lev, amrex::DistributionMapping& dm) const
+{
+    BL_PROFILE("amr-wind::LoadBalancer::rebalance");
+    const auto& mesh = m_sim.mesh();
+    const auto& ba = mesh.boxArray(lev);
+    const auto costs = box_costs(lev, ba);
+    const amrex::Real eff_old = efficiency(costs, mesh.DistributionMap(lev));
+
+    auto new_dm = make_distribution_map(lev, ba);
+    const amrex::Real eff_new = efficiency(costs, new_dm);
+
+    const bool improved = (eff_new > (1.0 + m_min_improvement) * eff_old);
+    if (m_verbose > 0) {
+        amrex::Print() << "LoadBalancer: level " << lev
+                       << " current efficiency = " << eff_old
+                       << ", proposed efficiency = " << eff_new
+                       << (improved ? " (rebalancing)" : "") << std::endl;
+    }
+    if (improved) {
+        dm = new_dm;
+    }
+    return improved;
+}
+
+amrex::Real LoadBalancer::efficiency(
+    const amrex::Vector<amrex::Real>& costs,
+    const amrex::DistributionMapping& dm)
+{
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    amrex::Vector<amrex::Real> rank_cost(nprocs, 0.0);
+    for (int i = 0; i < costs.size(); ++i) {
+        rank_cost[dm[i]] += costs[i];
+    }
+
+    amrex::Real total = 0.0;
+    amrex::Real cmax = 0.0;
+    for (const auto cc : rank_cost) {
+        total += cc;
+        cmax = amrex::max(cmax, cc);
+    }
+    return (cmax > 0.0) ? total / (nprocs * cmax) : 1.0;
+}
+
+} // namespace amr_wind
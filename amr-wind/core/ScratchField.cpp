@@ -47,6 +47,14 @@ scratch_field_bcrec(const amrex::Geometry& geom, const int ncomp)
 
 } // namespace
 
+ScratchField::~ScratchField()
+{
+    if (auto pool = m_pool.lock()) {
+        pool->release(
+            m_ncomp, m_ngrow, m_floc, m_pool_generation, std::move(m_data));
+    }
+}
+
 void ScratchField::fillpatch(amrex::Real time) noexcept
 {
     fillpatch(time, num_grow());
@@ -0,0 +1,135 @@
+#include "amr-wind/core/ScratchFieldPool.H"
+
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_Print.H"
+
+namespace amr_wind {
+
+ScratchFieldPool::Key ScratchFieldPool::make_key(
+    const int ncomp, const amrex::IntVect& ngrow, const FieldLoc floc)
+{
+    return Key{ncomp, ngrow[0], ngrow[1], ngrow[2], static_cast<int>(floc)};
+}
+
+amrex::Long ScratchFieldPool::nbytes(const LevelData& data)
+{
+    amrex::Long bytes = 0;
+    for (const auto& mf : data) {
+        for (int i = 0; i < mf.local_size(); ++i) {
+            bytes += static_cast<amrex::Long>(mf.atLocalIdx(i).nBytes());
+        }
+    }
+    return bytes;
+}
+
+void ScratchFieldPool::set_enabled(bool flag)
+{
+    m_enabled = flag;
+    if (!m_enabled) {
+        m_free.clear();
+        m_bytes_pooled = 0;
+    }
+}
+
+ScratchFieldPool::LevelData ScratchFieldPool::acquire(
+    const int ncomp,
+    const amrex::IntVect& ngrow,
+    const FieldLoc floc,
+    const amrex::Vector<amrex::BoxArray>& ba,
+    const amrex::Vector<amrex::DistributionMapping>& dm)
+{
+    BL_PROFILE("amr-wind::ScratchFieldPool::acquire");
+    AMREX_ASSERT(ba.size() == dm.size());
+
+    LevelData data;
+    if (!m_enabled) {
+        return data;
+    }
+
+    auto found = m_free.find(make_key(ncomp, ngrow, floc));
+    if (found != m_free.end()) {
+        auto& entries = found->second;
+        for (auto it = entries.begin(); it != entries.end(); ++it) {
+            if (it->size() != ba.size()) {
+                continue;
+            }
+
+            bool match = true;
+            for (int lev = 0; lev < ba.size(); ++lev) {
+                if (((*it)[lev].boxArray() != ba[lev]) ||
+                    ((*it)[lev].DistributionMap() != dm[lev])) {
+                    match = false;
+                    break;
+                }
+            }
+
+            if (match) {
+                data = std::move(*it);
+                entries.erase(it);
+                m_bytes_pooled -= nbytes(data);
+                ++m_step_hits;
+                return data;
+            }
+        }
+    }
+
+    ++m_step_misses;
+    return data;
+}
+
+void ScratchFieldPool::checkout(const LevelData& data)
+{
+    m_bytes_in_use += nbytes(data);
+    m_step_hwm = amrex::max(m_step_hwm, m_bytes_in_use);
+}
+
+void ScratchFieldPool::release(
+    const int ncomp,
+    const amrex::IntVect& ngrow,
+    const FieldLoc floc,
+    const int generation,
+    LevelData&& data)
+{
+    const amrex::Long bytes = nbytes(data);
+    m_bytes_in_use -= bytes;
+
+    if (!m_enabled || (generation != m_generation) || data.empty()) {
+        return;
+    }
+
+    m_free[make_key(ncomp, ngrow, floc)].push_back(std::move(data));
+    m_bytes_pooled += bytes;
+}
+
+void ScratchFieldPool::invalidate()
+{
+    m_free.clear();
+    m_bytes_pooled = 0;
+    ++m_generation;
+}
+
+void ScratchFieldPool::print_step_stats() const
+{
+    amrex::Long stats[3] = {m_step_hwm, m_bytes_in_use, m_bytes_pooled};
+    int counts[2] = {m_step_hits, m_step_misses};
+    amrex::ParallelDescriptor::ReduceLongMax(
+        stats, 3, amrex::ParallelDescriptor::IOProcessorNumber());
+    amrex::ParallelDescriptor::ReduceIntMax(
+        counts, 2, amrex::ParallelDescriptor::IOProcessorNumber());
+
+    constexpr double mb = 1024.0 * 1024.0;
+    amrex::Print() << "Scratch field memory (max over ranks): high-water mark "
+                   << static_cast<double>(stats[0]) / mb << " MB, in use "
+                   << static_cast<double>(stats[1]) / mb << " MB, pooled "
+                   << static_cast<double>(stats[2]) / mb << " MB; reused "
+                   << counts[0] << ", allocated " << counts[1] << std::endl;
+}
+
+void ScratchFieldPool::reset_step_stats()
+{
+    m_step_hwm = m_bytes_in_use;
+    m_step_hits = 0;
+    m_step_misses = 0;
+}
+
+} // namespace amr_wind
@@ -0,0 +1,76 @@
+#include "amr-wind/core/VelocityGradient.H"
+#include "amr-wind/CFDSim.H"
+#include "amr-wind/fvm/gradient.H"
+
+namespace amr_wind {
+
+namespace {
+
+//! Single-level view of a cached gradient for use with fvm::Gradient
+struct LevelGradient
+{
+    amrex::MultiFab& mfab;
+
+    int num_comp() const { return mfab.nComp(); }
+
+    amrex::MultiFab& operator()(int /*lev*/) { return mfab; }
+};
+
+} // namespace
+
+VelocityGradient::VelocityGradient(const CFDSim& sim) : m_sim(sim) {}
+
+int VelocityGradient::num_levels() const
+{
+    return m_sim.repo().num_active_levels();
+}
+
+const amrex::MultiFab&
+VelocityGradient::operator()(const int lev, const FieldState fstate)
+{
+    AMREX_ALWAYS_ASSERT(
+        (fstate == FieldState::New) || (fstate == FieldState::Old));
+    auto& cache = m_cache[static_cast<int>(fstate)];
+    if (cache.size() <= lev) {
+        cache.resize(lev + 1);
+    }
+
+    const auto& vel = m_sim.repo().get_field("velocity").state(fstate);
+    const auto& vmf = vel(lev);
+    auto& entry = cache[lev];
+    if (!entry.grad || (entry.grad->boxArray() != vmf.boxArray()) ||
+        (entry.grad->DistributionMap() != vmf.DistributionMap())) {
+        entry.grad = std::make_unique<amrex::MultiFab>(
+            vmf.boxArray(), vmf.DistributionMap(), ncomp, 0);
+        entry.valid = false;
+    }
+
+    const int time_index = m_sim.time().time_index();
+    const auto version = vel.version();
+    if (entry.valid && (entry.time_index == time_index) &&
+        (entry.version == version)) {
+        return *entry.grad;
+    }
+
+    BL_PROFILE("amr-wind::VelocityGradient::compute");
+    LevelGradient grad{*entry.grad};
+    fvm::Gradient<Field, LevelGradient> op(grad, vel);
+    fvm::impl::apply(op, vel, lev);
+
+    entry.time_index = time_index;
+    entry.version = version;
+    entry.valid = true;
+    ++m_num_evaluations;
+    return *entry.grad;
+}
+
+void VelocityGradient::invalidate()
+{
+    for (auto& cache : m_cache) {
+        for (auto& entry : cache) {
+            entry.valid = false;
+        }
+    }
+}
+
+} // namespace amr_wind
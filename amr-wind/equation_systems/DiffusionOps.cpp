@@ -22,25 +22,56 @@ DiffSolverIface<LinOp>::DiffSolverIface(
     iapply.setMaxCoarseningLevel(0);
 
     const auto& mesh = m_pdefields.repo.mesh();
-    if (!has_overset) {
-        m_solver.reset(new LinOp(
-            mesh.Geom(0, mesh.finestLevel()),
-            mesh.boxArray(0, mesh.finestLevel()),
-            mesh.DistributionMap(0, mesh.finestLevel()), isolve));
-        m_applier.reset(new LinOp(
-            mesh.Geom(0, mesh.finestLevel()),
-            mesh.boxArray(0, mesh.finestLevel()),
-            mesh.DistributionMap(0, mesh.finestLevel()), iapply));
+    if constexpr (std::is_same<LinOp, amrex::MLABecLaplacian>::value) {
+        // All components of a multi-component scalar are solved together
+        const int ncomp = m_pdefields.field.num_comp();
+        if (!has_overset) {
+            m_solver.reset(new LinOp(
+                mesh.Geom(0, mesh.finestLevel()),
+                mesh.boxArray(0, mesh.finestLevel()),
+                mesh.DistributionMap(0, mesh.finestLevel()), isolve, {},
+                ncomp));
+            m_applier.reset(new LinOp(
+                mesh.Geom(0, mesh.finestLevel()),
+                mesh.boxArray(0, mesh.finestLevel()),
+                mesh.DistributionMap(0, mesh.finestLevel()), iapply, {},
+                ncomp));
+        } else {
+            auto imask =
+                fields.repo.get_int_field("mask_cell").vec_const_ptrs();
+            m_solver.reset(new LinOp(
+                mesh.Geom(0, mesh.finestLevel()),
+                mesh.boxArray(0, mesh.finestLevel()),
+                mesh.DistributionMap(0, mesh.finestLevel()), imask, isolve,
+                {}, ncomp));
+            m_applier.reset(new LinOp(
+                mesh.Geom(0, mesh.finestLevel()),
+                mesh.boxArray(0, mesh.finestLevel()),
+                mesh.DistributionMap(0, mesh.finestLevel()), imask, iapply,
+                {}, ncomp));
+        }
     } else {
-        auto imask = fields.repo.get_int_field("mask_cell").vec_const_ptrs();
-        m_solver.reset(new LinOp(
-            mesh.Geom(0, mesh.finestLevel()),
-            mesh.boxArray(0, mesh.finestLevel()),
-            mesh.DistributionMap(0, mesh.finestLevel()), imask, isolve));
-        m_applier.reset(new LinOp(
-            mesh.Geom(0, mesh.finestLevel()),
-            mesh.boxArray(0, mesh.finestLevel()),
-            mesh.DistributionMap(0, mesh.finestLevel()), imask, iapply));
+        if (!has_overset) {
+            m_solver.reset(new LinOp(
+                mesh.Geom(0, mesh.finestLevel()),
+                mesh.boxArray(0, mesh.finestLevel()),
+                mesh.DistributionMap(0, mesh.finestLevel()), isolve));
+            m_applier.reset(new LinOp(
+                mesh.Geom(0, mesh.finestLevel()),
+                mesh.boxArray(0, mesh.finestLevel()),
+                mesh.DistributionMap(0, mesh.finestLevel()), iapply));
+        } else {
+            auto imask =
+                fields.repo.get_int_field("mask_cell").vec_const_ptrs();
+            m_solver.reset(new LinOp(
+                mesh.Geom(0, mesh.finestLevel()),
+                mesh.boxArray(0, mesh.finestLevel()),
+                mesh.DistributionMap(0, mesh.finestLevel()), imask, isolve));
+            m_applier.reset(new LinOp(
+                mesh.Geom(0, mesh.finestLevel()),
+                mesh.boxArray(0, mesh.finestLevel()),
+                mesh.DistributionMap(0, mesh.finestLevel()), imask, iapply));
+        }
     }
 
     m_solver->setMaxOrder(m_options.max_order);
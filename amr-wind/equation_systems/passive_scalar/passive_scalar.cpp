@@ -3,8 +3,19 @@
 #include "amr-wind/equation_systems/AdvOp_MOL.H"
 #include "amr-wind/equation_systems/BCOps.H"
 
+#include "AMReX_ParmParse.H"
+
 namespace amr_wind::pde {
 
+int PassiveScalar::num_components()
+{
+    int nscalars = 1;
+    amrex::ParmParse pp(pde_name());
+    pp.query("num_scalars", nscalars);
+    AMREX_ALWAYS_ASSERT(nscalars > 0);
+    return nscalars;
+}
+
 template class PDESystem<PassiveScalar, fvm::Godunov>;
 template class PDESystem<PassiveScalar, fvm::MOL>;
 
@@ -59,7 +59,17 @@ void IB::post_init_actions()
     }
 }
 
-void IB::post_regrid_actions() {}
+void IB::post_regrid_actions()
+{
+    BL_PROFILE("amr-wind::ib::IB::post_regrid_actions");
+    // The node mask is reset on regrid and the level set of new fine levels
+    // is only interpolated, so recompute both on the new grids
+    m_ib_levelset.setVal(1e30);
+
+    for (auto& ib : m_ibs) {
+        ib->init_ib();
+    }
+}
 
 void IB::pre_advance_work()
 {
@@ -112,6 +122,60 @@ void IB::compute_forces()
     }
 }
 
+/** Rebuild the level set and node mask where immersed boundaries moved
+ *
+ *  The level set and node mask combine all immersed boundaries, so the cells
+ *  around the previous and new locations of the moving ones are reset and
+ *  every immersed boundary adds its contribution back there.
+ */
+void IB::update_moved_regions()
+{
+    BL_PROFILE("amr-wind::ib::IB::update_moved_regions");
+    auto& mask_node = m_sim.repo().get_int_field("mask_node");
+
+    const int nlevels = m_sim.repo().num_active_levels();
+    amrex::Vector<amrex::Box> regions(nlevels);
+    bool moved = false;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (const auto& ib : m_ibs) {
+            const auto bx = ib->changed_region(lev);
+            if (!bx.ok()) {
+                continue;
+            }
+            if (regions[lev].ok()) {
+                regions[lev].minBox(bx);
+            } else {
+                regions[lev] = bx;
+            }
+            moved = true;
+        }
+    }
+    if (!moved) {
+        return;
+    }
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        if (!regions[lev].ok()) {
+            continue;
+        }
+        const auto nregion = amrex::surroundingNodes(regions[lev]);
+        for (amrex::MFIter mfi(m_ib_levelset(lev)); mfi.isValid(); ++mfi) {
+            const auto bx = mfi.growntilebox() & regions[lev];
+            if (bx.ok()) {
+                m_ib_levelset(lev)[mfi].setVal<amrex::RunOn::Device>(1e30, bx);
+            }
+            const auto nbx = mfi.nodaltilebox() & nregion;
+            if (nbx.ok()) {
+                mask_node(lev)[mfi].setVal<amrex::RunOn::Device>(1, nbx);
+            }
+        }
+    }
+
+    for (auto& ib : m_ibs) {
+        ib->update_region(regions);
+    }
+}
+
 void IB::prepare_outputs()
 {
     const std::string out_dir_prefix = "post_processing/immersed_boundary";
@@ -131,6 +195,11 @@ void IB::post_advance_work()
     for (auto& ib : m_ibs) {
         ib->compute_forces();
         ib->update_positions();
+    }
+
+    update_moved_regions();
+
+    for (auto& ib : m_ibs) {
         ib->write_outputs();
     }
 }
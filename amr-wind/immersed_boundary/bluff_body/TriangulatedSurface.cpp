@@ -0,0 +1,136 @@
+#include "amr-wind/immersed_boundary/bluff_body/TriangulatedSurface.H"
+#include "amr-wind/immersed_boundary/bluff_body/triangulated_surface_ops.H"
+#include "amr-wind/immersed_boundary/IBModel.H"
+
+namespace amr_wind::ib {
+
+template class IBModel<TriangulatedSurface>;
+
+namespace triangulated_surface {
+
+namespace {
+
+//! Width of the band around the surface where the distance is computed
+amrex::Real
+band_width(const TriangulatedSurfaceData& wdata, const amrex::Geometry& geom)
+{
+    const auto& dx = geom.CellSizeArray();
+    return wdata.num_band_cells * amrex::max(dx[0], amrex::max(dx[1], dx[2]));
+}
+
+//! Cells within `band` of the bounding box of the surface
+amrex::Box band_region(
+    const amrex::RealBox& bbox,
+    const vs::Vector& disp,
+    const amrex::Real band,
+    const amrex::Geometry& geom)
+{
+    const auto& problo = geom.ProbLoArray();
+    const auto& dxi = geom.InvCellSizeArray();
+    amrex::IntVect lo;
+    amrex::IntVect hi;
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        lo[d] = static_cast<int>(
+            std::floor((bbox.lo(d) + disp[d] - band - problo[d]) * dxi[d]));
+        hi[d] = static_cast<int>(
+            std::floor((bbox.hi(d) + disp[d] + band - problo[d]) * dxi[d]));
+    }
+    return amrex::Box(lo, hi);
+}
+
+} // namespace
+
+void set_changed_regions(
+    TriangulatedSurface::DataType& data, const vs::Vector& old_disp)
+{
+    auto& wdata = data.meta();
+    const auto& bbox = wdata.surface.bounding_box();
+    const auto& sim = data.sim();
+
+    const int nlevels = sim.repo().num_active_levels();
+    wdata.changed_regions.resize(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& geom = sim.mesh().Geom(lev);
+        const amrex::Real band = band_width(wdata, geom);
+        auto region = band_region(bbox, wdata.displacement, band, geom);
+        region.minBox(band_region(bbox, old_disp, band, geom));
+        wdata.changed_regions[lev] = region;
+    }
+}
+
+void update_levelset(
+    TriangulatedSurface::DataType& data,
+    const amrex::Vector<amrex::Box>& regions)
+{
+    BL_PROFILE("amr-wind::ib::TriangulatedSurface::update_levelset");
+    const auto& wdata = data.meta();
+    const auto& surf = wdata.surface;
+    auto& sim = data.sim();
+    // cppcheck-suppress constVariableReference
+    auto& mask_node = sim.repo().get_int_field("mask_node");
+    // cppcheck-suppress constVariableReference
+    auto& levelset = sim.repo().get_field("ib_levelset");
+
+    const int nlevels = sim.repo().num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& geom = sim.mesh().Geom(lev);
+        const auto& dx = geom.CellSizeArray();
+        const amrex::Real band = band_width(wdata, geom);
+
+        // Location of the domain in the frame of the surface file
+        amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> plo;
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            plo[d] = geom.ProbLo(d) - wdata.displacement[d];
+        }
+
+        // Only the cells around the body are updated
+        auto region =
+            band_region(surf.bounding_box(), wdata.displacement, band, geom);
+        if (!regions.empty()) {
+            region &= regions[lev];
+        }
+        if (!region.ok()) {
+            continue;
+        }
+        const auto nregion = amrex::surroundingNodes(region);
+
+        // The distance is computed on the host into pinned buffers that are
+        // read directly by the device kernels
+        for (amrex::MFIter mfi(levelset(lev)); mfi.isValid(); ++mfi) {
+            const auto bx = mfi.growntilebox() & region;
+            if (bx.ok()) {
+                amrex::FArrayBox phi_fab(bx, 1, amrex::The_Pinned_Arena());
+                surf.signed_distance(bx, plo, dx, band, phi_fab.array());
+
+                const auto& phi_loc = phi_fab.const_array();
+                const auto& phi = levelset(lev).array(mfi);
+                amrex::ParallelFor(
+                    bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                        phi(i, j, k) =
+                            amrex::min(phi_loc(i, j, k), phi(i, j, k));
+                    });
+                amrex::Gpu::streamSynchronize();
+            }
+
+            const auto nbx = mfi.nodaltilebox() & nregion;
+            if (nbx.ok()) {
+                amrex::IArrayBox inside(nbx, 1, amrex::The_Pinned_Arena());
+                surf.contains(nbx, plo, dx, inside.array());
+
+                const auto& inside_arr = inside.const_array();
+                const auto& epsilon_node = mask_node(lev).array(mfi);
+                amrex::ParallelFor(
+                    nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                        if (inside_arr(i, j, k) != 0) {
+                            epsilon_node(i, j, k) = 0;
+                        }
+                    });
+                amrex::Gpu::streamSynchronize();
+            }
+        }
+    }
+}
+
+} // namespace triangulated_surface
+
+} // namespace amr_wind::ib
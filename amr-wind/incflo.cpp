@@ -2,11 +2,14 @@
 
 #include "amr-wind/wind_energy/ABL.H"
 #include "amr-wind/utilities/tagging/RefinementCriteria.H"
+#include "amr-wind/core/LoadBalancer.H"
+#include "amr-wind/core/VelocityGradient.H"
 #include "amr-wind/equation_systems/PDEBase.H"
 #include "amr-wind/turbulence/TurbulenceModel.H"
 #include "amr-wind/equation_systems/SchemeTraits.H"
 #include "amr-wind/utilities/IOManager.H"
 #include "amr-wind/utilities/PostProcessing.H"
+#include "amr-wind/utilities/PerfReport.H"
 #include "amr-wind/overset/OversetManager.H"
 
 #include "AMReX_ParmParse.H"
@@ -18,6 +21,7 @@ incflo::incflo()
     , m_time(m_sim.time())
     , m_repo(m_sim.repo())
     , m_mesh_refiner(new amr_wind::RefineCriteriaManager(m_sim))
+    , m_load_balancer(new amr_wind::LoadBalancer(m_sim))
 {
     // NOTE: Geometry on all levels has just been defined in the AmrCore
     // constructor. No valid BoxArray and DistributionMapping have been defined.
@@ -88,6 +92,7 @@ void incflo::init_mesh()
 void incflo::init_amr_wind_modules()
 {
     BL_PROFILE("amr-wind::incflo::init_amr_wind_modules");
+    amr_wind::perf::initialize();
     if (m_sim.has_overset()) {
         m_sim.overset_manager()->post_init_actions();
     } else {
@@ -141,6 +146,11 @@ void incflo::prepare_for_time_integration()
     if (m_time.write_checkpoint()) {
         m_sim.io_manager().write_checkpoint_file();
     }
+
+    if (m_verbose > 0) {
+        m_repo.scratch_pool().print_step_stats();
+    }
+    m_repo.scratch_pool().reset_step_stats();
 }
 
 /** Perform all initialization actions for AMR-Wind.
@@ -161,13 +171,15 @@ void incflo::InitData()
 
 /** Perform regrid actions at a given timestep.
  *
- *  \return Flag indicating if regrid was performed
+ *  \return Flag indicating if the mesh was regridded or redistributed
  */
 bool incflo::regrid_and_update()
 {
     BL_PROFILE("amr-wind::incflo::regrid_and_update");
+    amr_wind::perf::ScopedTimer perf_timer(amr_wind::perf::Region::regrid);
 
-    if (m_time.do_regrid()) {
+    bool mesh_changed = m_time.do_regrid();
+    if (mesh_changed) {
         amrex::Print() << "Regrid mesh ... ";
         amrex::Real rstart = amrex::ParallelDescriptor::second();
         regrid(0, m_time.current_time());
@@ -177,7 +189,11 @@ bool incflo::regrid_and_update()
             amrex::Print() << "Grid summary: " << std::endl;
             printGridSummary(amrex::OutStream(), 0, finest_level);
         }
+    } else if (m_load_balancer->rebalance_due(m_time.time_index())) {
+        mesh_changed = rebalance();
+    }
 
+    if (mesh_changed) {
         // update mesh map
         {
             if (m_sim.has_mesh_mapping()) {
@@ -202,6 +218,7 @@ bool incflo::regrid_and_update()
         }
 
         m_sim.pde_manager().fillpatch_state_fields(m_time.current_time());
+        m_sim.velocity_gradient().invalidate();
 
         icns().post_regrid_actions();
         for (auto& eqn : scalar_eqns()) {
@@ -221,7 +238,7 @@ bool incflo::regrid_and_update()
         }
     }
 
-    return m_time.do_regrid();
+    return mesh_changed;
 }
 
 /** Perform actions after a timestep
@@ -250,6 +267,11 @@ void incflo::post_advance_work()
     if (m_time.write_checkpoint()) {
         m_sim.io_manager().write_checkpoint_file();
     }
+
+    if (m_verbose > 0) {
+        m_repo.scratch_pool().print_step_stats();
+    }
+    m_repo.scratch_pool().reset_step_stats();
 }
 
 /** Perform time-integration for user-defined time or timesteps.
@@ -261,6 +283,7 @@ void incflo::Evolve()
     BL_PROFILE("amr-wind::incflo::Evolve()");
 
     while (m_time.new_timestep()) {
+        amr_wind::perf::begin_step();
         amrex::Real time0 = amrex::ParallelDescriptor::second();
 
         regrid_and_update();
@@ -294,6 +317,9 @@ void incflo::Evolve()
                               (time2 - time1) /
                               static_cast<amrex::Real>(m_cell_count)
                        << std::endl;
+
+        amr_wind::perf::end_step(
+            m_time, m_cell_count, time1 - time0, time2 - time1, time3 - time2);
     }
     amrex::Print() << "\n======================================================"
                       "========================\n"
@@ -306,6 +332,9 @@ void incflo::Evolve()
     if (m_time.write_last_checkpoint()) {
         m_sim.io_manager().write_checkpoint_file();
     }
+
+    // Ensure all asynchronous output is on disk before returning
+    m_sim.io_manager().wait_for_output();
 }
 
 void incflo::do_advance()
@@ -340,6 +369,7 @@ void incflo::MakeNewLevelFromScratch(
     SetDistributionMap(lev, new_dmap);
 
     m_repo.make_new_level_from_scratch(lev, time, new_grids, new_dmap);
+    reset_nodal_projector();
 
     // initialize the mesh map before initializing physics
     if (m_sim.has_mesh_mapping()) {
@@ -3,8 +3,10 @@
 #include "amr-wind/incflo.H"
 #include "amr-wind/core/Physics.H"
 #include "amr-wind/core/field_ops.H"
+#include "amr-wind/core/VelocityGradient.H"
 #include "amr-wind/equation_systems/PDEBase.H"
 #include "amr-wind/turbulence/TurbulenceModel.H"
+#include "amr-wind/utilities/PerfReport.H"
 #include "amr-wind/utilities/console_io.H"
 #include "amr-wind/utilities/PostProcessing.H"
 #include "AMReX_MultiFabUtil.H"
@@ -202,8 +204,12 @@ void incflo::ApplyPredictor(bool incremental_projection)
     // *************************************************************************************
     // TODO: This sub-section has not been adjusted for mesh mapping - adjust in
     // corrector too
-    m_sim.turbulence_model().update_turbulent_viscosity(
-        amr_wind::FieldState::Old, m_diff_type);
+    {
+        amr_wind::perf::ScopedTimer perf_timer(
+            amr_wind::perf::Region::turbulence);
+        m_sim.turbulence_model().update_turbulent_viscosity(
+            amr_wind::FieldState::Old, m_diff_type);
+    }
     icns().compute_mueff(amr_wind::FieldState::Old);
     for (auto& eqns : scalar_eqns()) {
         eqns->compute_mueff(amr_wind::FieldState::Old);
@@ -323,18 +329,23 @@ void incflo::ApplyPredictor(bool incremental_projection)
             amr_wind::field_ops::copy(*diff_old, diff_new, 0, 0, 1, 0);
             eqn->compute_diffusion_term(amr_wind::FieldState::New);
             amrex::Real dto2 = 0.5 * m_time.deltaT();
-            amr_wind::field_ops::saxpy(
-                eqn->fields().field, -dto2, *diff_old, 0, 0, 1, 0);
-            amr_wind::field_ops::saxpy(
-                eqn->fields().field, +dto2, diff_new, 0, 0, 1, 0);
+            auto& fld = eqn->fields().field;
+            amr_wind::field_ops::assign(
+                fld,
+                amr_wind::field_ops::term(fld) -
+                    dto2 * amr_wind::field_ops::term(*diff_old) +
+                    dto2 * amr_wind::field_ops::term(diff_new),
+                0, 1, 0);
         }
         eqn->post_solve_actions();
 
         // Update scalar at n+1/2
-        amr_wind::field_ops::lincomb(
-            field.state(amr_wind::FieldState::NPH), 0.5,
-            field.state(amr_wind::FieldState::Old), 0, 0.5, field, 0, 0,
-            field.num_comp(), 1);
+        amr_wind::field_ops::assign(
+            field.state(amr_wind::FieldState::NPH),
+            0.5 * amr_wind::field_ops::term(
+                      field.state(amr_wind::FieldState::Old)) +
+                0.5 * amr_wind::field_ops::term(field),
+            0, field.num_comp(), 1);
     }
 
     // With scalars computed, compute advection of momentum
@@ -376,12 +387,16 @@ void incflo::ApplyPredictor(bool incremental_projection)
         amr_wind::field_ops::copy(*diff_old, diff_new, 0, 0, AMREX_SPACEDIM, 0);
         icns().compute_diffusion_term(amr_wind::FieldState::New);
         amrex::Real dto2 = 0.5 * m_time.deltaT();
-        amr_wind::field_ops::saxpy(
-            icns().fields().field, -dto2, *diff_old, 0, 0, AMREX_SPACEDIM, 0);
-        amr_wind::field_ops::saxpy(
-            icns().fields().field, +dto2, diff_new, 0, 0, AMREX_SPACEDIM, 0);
+        auto& vel = icns().fields().field;
+        amr_wind::field_ops::assign(
+            vel,
+            amr_wind::field_ops::term(vel) -
+                dto2 * amr_wind::field_ops::term(*diff_old) +
+                dto2 * amr_wind::field_ops::term(diff_new),
+            0, AMREX_SPACEDIM, 0);
     }
     icns().post_solve_actions();
+    m_sim.velocity_gradient().invalidate();
 
     if (m_verbose > 2) {
         PrintMaxVelLocations("after diffusion solve");
@@ -523,8 +538,12 @@ void incflo::ApplyCorrector()
     // *************************************************************************************
     // Compute viscosity / diffusive coefficients
     // *************************************************************************************
-    m_sim.turbulence_model().update_turbulent_viscosity(
-        amr_wind::FieldState::New, m_diff_type);
+    {
+        amr_wind::perf::ScopedTimer perf_timer(
+            amr_wind::perf::Region::turbulence);
+        m_sim.turbulence_model().update_turbulent_viscosity(
+            amr_wind::FieldState::New, m_diff_type);
+    }
     icns().compute_mueff(amr_wind::FieldState::New);
     for (auto& eqns : scalar_eqns()) {
         eqns->compute_mueff(amr_wind::FieldState::New);
@@ -574,10 +593,12 @@ void incflo::ApplyCorrector()
         eqn->post_solve_actions();
 
         // Update scalar at n+1/2
-        amr_wind::field_ops::lincomb(
-            field.state(amr_wind::FieldState::NPH), 0.5,
-            field.state(amr_wind::FieldState::Old), 0, 0.5, field, 0, 0,
-            field.num_comp(), 1);
+        amr_wind::field_ops::assign(
+            field.state(amr_wind::FieldState::NPH),
+            0.5 * amr_wind::field_ops::term(
+                      field.state(amr_wind::FieldState::Old)) +
+                0.5 * amr_wind::field_ops::term(field),
+            0, field.num_comp(), 1);
     }
 
     // *************************************************************************************
@@ -606,6 +627,7 @@ void incflo::ApplyCorrector()
         icns().solve(dt_diff);
     }
     icns().post_solve_actions();
+    m_sim.velocity_gradient().invalidate();
 
     // *************************************************************************************
     // Project velocity field, update pressure
@@ -642,8 +664,12 @@ void incflo::ApplyPrescribeStep()
     auto& density_nph = density_new.state(amr_wind::FieldState::NPH);
 
     // Compute diffusive and source terms for scalars
-    m_sim.turbulence_model().update_turbulent_viscosity(
-        amr_wind::FieldState::Old, m_diff_type);
+    {
+        amr_wind::perf::ScopedTimer perf_timer(
+            amr_wind::perf::Region::turbulence);
+        m_sim.turbulence_model().update_turbulent_viscosity(
+            amr_wind::FieldState::Old, m_diff_type);
+    }
     for (auto& eqns : scalar_eqns()) {
         eqns->compute_mueff(amr_wind::FieldState::Old);
     }
@@ -718,10 +744,12 @@ void incflo::ApplyPrescribeStep()
         eqn->post_solve_actions();
 
         // Update scalar at n+1/2
-        amr_wind::field_ops::lincomb(
-            field.state(amr_wind::FieldState::NPH), 0.5,
-            field.state(amr_wind::FieldState::Old), 0, 0.5, field, 0, 0,
-            field.num_comp(), 1);
+        amr_wind::field_ops::assign(
+            field.state(amr_wind::FieldState::NPH),
+            0.5 * amr_wind::field_ops::term(
+                      field.state(amr_wind::FieldState::Old)) +
+                0.5 * amr_wind::field_ops::term(field),
+            0, field.num_comp(), 1);
     }
 
     // With scalars computed, compute advection of momentum
@@ -732,4 +760,5 @@ void incflo::ApplyPrescribeStep()
     icns().compute_predictor_rhs(DiffusionType::Explicit);
 
     icns().post_solve_actions();
+    m_sim.velocity_gradient().invalidate();
 }
@@ -1,4 +1,5 @@
 #include "amr-wind/incflo.H"
+#include "amr-wind/core/LoadBalancer.H"
 
 using namespace amrex;
 
@@ -16,6 +17,7 @@ void incflo::MakeNewLevelFromCoarse(
     }
 
     m_repo.make_new_level_from_coarse(lev, time, ba, dm);
+    reset_nodal_projector();
 }
 
 // Remake an existing level using provided BoxArray and DistributionMapping and
@@ -31,6 +33,7 @@ void incflo::RemakeLevel(
     }
 
     m_repo.remake_level(lev, time, ba, dm);
+    reset_nodal_projector();
 }
 
 // Delete level data
@@ -39,4 +42,34 @@ void incflo::ClearLevel(int lev)
 {
     BL_PROFILE("amr-wind::incflo::ClearLevel()");
     m_repo.clear_level(lev);
+    reset_nodal_projector();
+}
+
+// Create the distribution mapping for a new BoxArray
+// overrides the virtual function in AmrMesh
+DistributionMapping
+incflo::MakeDistributionMap(int lev, const BoxArray& ba)
+{
+    BL_PROFILE("amr-wind::incflo::MakeDistributionMap()");
+    if (!m_load_balancer->enabled()) {
+        return AmrCore::MakeDistributionMap(lev, ba);
+    }
+    return m_load_balancer->make_distribution_map(lev, ba);
+}
+
+// Redistribute the existing grids based on the estimated cost of each box
+bool incflo::rebalance()
+{
+    BL_PROFILE("amr-wind::incflo::rebalance()");
+    bool rebalanced = false;
+    const Real time = m_time.current_time();
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        DistributionMapping dm;
+        if (m_load_balancer->rebalance(lev, dm)) {
+            RemakeLevel(lev, time, boxArray(lev), dm);
+            SetDistributionMap(lev, dm);
+            rebalanced = true;
+        }
+    }
+    return rebalanced;
 }
@@ -48,6 +48,14 @@ int main(int argc, char* argv[])
         if (!pp.contains("signal_handling")) {
             pp.add("signal_handling", 0);
         }
+        // Asynchronous plot/checkpoint output (io.async_output) uses the
+        // AMReX output thread, which is set up during initialization
+        amrex::ParmParse pp_io("io");
+        bool async_output = false;
+        pp_io.query("async_output", async_output);
+        if (async_output && !pp.contains("async_out")) {
+            pp.add("async_out", 1);
+        }
     });
 
     { /* These braces are necessary to ensure amrex::Finalize() can be called
@@ -0,0 +1,364 @@
+#include "amr-wind/ocean_waves/relaxation_zones/HOSReader.H"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+
+#include "AMReX.H"
+#include "AMReX_ParallelDescriptor.H"
+
+namespace amr_wind::ocean_waves {
+
+namespace {
+
+constexpr char binary_tag[] = "AMRWHOS1";
+constexpr std::size_t binary_tag_len = 8;
+
+void read_array(std::istream& is, RealList& arr)
+{
+    const auto nbytes =
+        static_cast<std::streamsize>(arr.size() * sizeof(double));
+    if constexpr (std::is_same_v<amrex::Real, double>) {
+        is.read(reinterpret_cast<char*>(arr.data()), nbytes);
+    } else {
+        amrex::Vector<double> buf(arr.size());
+        is.read(reinterpret_cast<char*>(buf.data()), nbytes);
+        std::copy(buf.begin(), buf.end(), arr.begin());
+    }
+}
+
+void write_array(std::ostream& os, const RealList& arr)
+{
+    const auto nbytes =
+        static_cast<std::streamsize>(arr.size() * sizeof(double));
+    if constexpr (std::is_same_v<amrex::Real, double>) {
+        os.write(reinterpret_cast<const char*>(arr.data()), nbytes);
+    } else {
+        amrex::Vector<double> buf(arr.begin(), arr.end());
+        os.write(reinterpret_cast<const char*>(buf.data()), nbytes);
+    }
+}
+
+bool file_state(
+    const std::string& fname,
+    std::filesystem::file_time_type& mtime,
+    std::uintmax_t& size)
+{
+    std::error_code ec;
+    mtime = std::filesystem::last_write_time(fname, ec);
+    if (ec) {
+        return false;
+    }
+    size = std::filesystem::file_size(fname, ec);
+    return !ec;
+}
+
+void allocate(HOSSnapshot& snap)
+{
+    const long npts2d = static_cast<long>(snap.nx) * snap.ny;
+    snap.eta.resize(npts2d);
+    snap.u.resize(npts2d * snap.nz);
+    snap.v.resize(npts2d * snap.nz);
+    snap.w.resize(npts2d * snap.nz);
+}
+
+bool parse_text(const std::string& fname, HOSSnapshot& snap)
+{
+    std::ifstream is(fname);
+    if (!is.good()) {
+        return false;
+    }
+    // Read metadata from file
+    std::string tmp;
+    try {
+        // Get initial time
+        std::getline(is, tmp, '=');
+        std::getline(is, tmp);
+        snap.t = std::stod(tmp);
+        // Get dt
+        std::getline(is, tmp, '=');
+        std::getline(is, tmp);
+        snap.dt = std::stod(tmp);
+        // Get nx, Lx
+        std::getline(is, tmp, '=');
+        std::getline(is, tmp, ',');
+        snap.nx = std::stoi(tmp);
+        std::getline(is, tmp, '=');
+        std::getline(is, tmp);
+        snap.Lx = std::stod(tmp);
+        // Get ny, Ly
+        std::getline(is, tmp, '=');
+        std::getline(is, tmp, ',');
+        snap.ny = std::stoi(tmp);
+        std::getline(is, tmp, '=');
+        std::getline(is, tmp);
+        snap.Ly = std::stod(tmp);
+        // Get nz, zmin, zmax
+        std::getline(is, tmp, '=');
+        std::getline(is, tmp, ',');
+        snap.nz = std::stoi(tmp);
+        std::getline(is, tmp, '=');
+        std::getline(is, tmp, ',');
+        snap.zmin = std::stod(tmp);
+        std::getline(is, tmp, '=');
+        std::getline(is, tmp);
+        snap.zmax = std::stod(tmp);
+    } catch (const std::exception&) {
+        return false;
+    }
+
+    allocate(snap);
+    // Skip key
+    std::getline(is, tmp);
+    // Read interface heights and velocities
+    const int nz = snap.nz;
+    for (int ilat = 0; ilat < snap.nx * snap.ny; ++ilat) {
+        // Get eta for current point
+        is >> snap.eta[ilat];
+        // Get u, v, w for full depth of 2D point
+        for (int ivert = 0; ivert < nz; ++ivert) {
+            is >> snap.u[ilat * nz + ivert] >> snap.v[ilat * nz + ivert] >>
+                snap.w[ilat * nz + ivert];
+        }
+    }
+    return !is.fail();
+}
+
+bool parse_binary(const std::string& fname, HOSSnapshot& snap)
+{
+    std::ifstream is(fname, std::ios::binary);
+    if (!is.good()) {
+        return false;
+    }
+
+    char tag[binary_tag_len];
+    is.read(tag, binary_tag_len);
+    if (!is.good() || (std::strncmp(tag, binary_tag, binary_tag_len) != 0)) {
+        return false;
+    }
+
+    std::int32_t dims[4];
+    is.read(reinterpret_cast<char*>(dims), sizeof(dims));
+    snap.nx = dims[0];
+    snap.ny = dims[1];
+    snap.nz = dims[2];
+
+    double hdr[6];
+    is.read(reinterpret_cast<char*>(hdr), sizeof(hdr));
+    if (!is.good() || (dims[0] < 0) || (dims[1] < 0) || (dims[2] < 0)) {
+        return false;
+    }
+    snap.t = hdr[0];
+    snap.dt = hdr[1];
+    snap.Lx = hdr[2];
+    snap.Ly = hdr[3];
+    snap.zmin = hdr[4];
+    snap.zmax = hdr[5];
+
+    allocate(snap);
+    read_array(is, snap.eta);
+    read_array(is, snap.u);
+    read_array(is, snap.v);
+    read_array(is, snap.w);
+
+    return is.good();
+}
+
+} // namespace
+
+namespace hos {
+
+FileFormat parse_format(const std::string& fmt)
+{
+    if (fmt == "text") {
+        return FileFormat::text;
+    }
+    if (fmt == "binary") {
+        return FileFormat::binary;
+    }
+    amrex::Abort("HOS OceanWaves: Invalid HOS file format: " + fmt);
+    return FileFormat::text;
+}
+
+std::string filename(const std::string& prefix, int lev, int n, FileFormat fmt)
+{
+    std::stringstream fname;
+    fname << prefix << "_lev" << lev << "_" << n
+          << ((fmt == FileFormat::binary) ? ".bin" : ".txt");
+    return fname.str();
+}
+
+void read_text(const std::string& fname, HOSSnapshot& snap)
+{
+    if (!parse_text(fname, snap)) {
+        amrex::Abort("HOS OceanWaves: Error reading HOS file " + fname);
+    }
+}
+
+void read_binary(const std::string& fname, HOSSnapshot& snap)
+{
+    if (!parse_binary(fname, snap)) {
+        amrex::Abort("HOS OceanWaves: Error reading HOS file " + fname);
+    }
+}
+
+void write_binary(const std::string& fname, const HOSSnapshot& snap)
+{
+    std::ofstream os(fname, std::ios::binary);
+    if (!os.good()) {
+        amrex::Abort("HOS OceanWaves: Unable to open file " + fname);
+    }
+
+    os.write(binary_tag, binary_tag_len);
+    const std::int32_t dims[4] = {snap.nx, snap.ny, snap.nz, 0};
+    os.write(reinterpret_cast<const char*>(dims), sizeof(dims));
+    const double hdr[6] = {snap.t,  snap.dt,   snap.Lx,
+                           snap.Ly, snap.zmin, snap.zmax};
+    os.write(reinterpret_cast<const char*>(hdr), sizeof(hdr));
+
+    write_array(os, snap.eta);
+    write_array(os, snap.u);
+    write_array(os, snap.v);
+    write_array(os, snap.w);
+}
+
+void read_file(const std::string& fname, FileFormat fmt, HOSSnapshot& snap)
+{
+    if (fmt == FileFormat::binary) {
+        read_binary(fname, snap);
+    } else {
+        read_text(fname, snap);
+    }
+}
+
+void broadcast(HOSSnapshot& snap, int root)
+{
+    if (amrex::ParallelDescriptor::NProcs() == 1) {
+        return;
+    }
+
+    int dims[3] = {snap.nx, snap.ny, snap.nz};
+    amrex::Real hdr[6] = {snap.t,  snap.dt,   snap.Lx,
+                          snap.Ly, snap.zmin, snap.zmax};
+    amrex::ParallelDescriptor::Bcast(dims, 3, root);
+    amrex::ParallelDescriptor::Bcast(hdr, 6, root);
+
+    snap.nx = dims[0];
+    snap.ny = dims[1];
+    snap.nz = dims[2];
+    snap.t = hdr[0];
+    snap.dt = hdr[1];
+    snap.Lx = hdr[2];
+    snap.Ly = hdr[3];
+    snap.zmin = hdr[4];
+    snap.zmax = hdr[5];
+
+    if (amrex::ParallelDescriptor::MyProc() != root) {
+        allocate(snap);
+    }
+    amrex::ParallelDescriptor::Bcast(snap.eta.data(), snap.eta.size(), root);
+    amrex::ParallelDescriptor::Bcast(snap.u.data(), snap.u.size(), root);
+    amrex::ParallelDescriptor::Bcast(snap.v.data(), snap.v.size(), root);
+    amrex::ParallelDescriptor::Bcast(snap.w.data(), snap.w.size(), root);
+}
+
+} // namespace hos
+
+HOSReader::HOSReader(std::string prefix, hos::FileFormat fmt, bool prefetch)
+    : m_prefix(std::move(prefix)), m_fmt(fmt), m_prefetch(prefetch)
+{}
+
+HOSReader::~HOSReader()
+{
+    if (m_pending.valid()) {
+        m_pending.wait();
+    }
+}
+
+void HOSReader::finish_prefetch()
+{
+    if (!m_pending.valid()) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::HOSReader::finish_prefetch");
+    m_staged = m_pending.get();
+    m_staged_n = m_pending_n;
+    m_pending_n = -1;
+}
+
+void HOSReader::read(int lev, int n, HOSSnapshot& snap)
+{
+    BL_PROFILE("amr-wind::HOSReader::read");
+    const int root = amrex::ParallelDescriptor::IOProcessorNumber();
+    if (amrex::ParallelDescriptor::MyProc() == root) {
+        if (m_pending_n == n) {
+            finish_prefetch();
+        }
+
+        const auto fname = hos::filename(m_prefix, lev, n, m_fmt);
+        bool use_staged = (m_staged_n == n) && (lev < m_staged.size()) &&
+                          m_staged[lev].valid;
+        if (use_staged) {
+            // Discard the prefetched data if the file changed since
+            std::filesystem::file_time_type mtime;
+            std::uintmax_t size = 0;
+            use_staged = file_state(fname, mtime, size) &&
+                         (mtime == m_staged[lev].mtime) &&
+                         (size == m_staged[lev].size);
+        }
+
+        if (use_staged) {
+            snap = std::move(m_staged[lev].snap);
+        } else {
+            hos::read_file(fname, m_fmt, snap);
+        }
+        if (lev < m_staged.size()) {
+            m_staged[lev] = StagedSnapshot();
+        }
+    }
+
+    hos::broadcast(snap, root);
+}
+
+void HOSReader::prefetch(int nlevels, int n)
+{
+    if (!m_prefetch || !amrex::ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+
+    // Discard results of a prefetch that was never used
+    finish_prefetch();
+    m_staged.clear();
+    m_staged_n = -1;
+
+    amrex::Vector<std::string> fnames(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        fnames[lev] = hos::filename(m_prefix, lev, n, m_fmt);
+    }
+
+    // The helper thread performs file I/O only, all communication happens in
+    // HOSReader::read on the main thread
+    const auto fmt = m_fmt;
+    m_pending_n = n;
+    m_pending = std::async(std::launch::async, [fnames, fmt]() {
+        amrex::Vector<StagedSnapshot> snaps(fnames.size());
+        for (int lev = 0; lev < fnames.size(); ++lev) {
+            // Missing files are skipped; HOSReader::read will report them if
+            // they are actually requested
+            auto& staged = snaps[lev];
+            if (file_state(fnames[lev], staged.mtime, staged.size)) {
+                staged.valid = (fmt == hos::FileFormat::binary)
+                                   ? parse_binary(fnames[lev], staged.snap)
+                                   : parse_text(fnames[lev], staged.snap);
+            }
+        }
+        return snaps;
+    });
+}
+
+} // namespace amr_wind::ocean_waves
@@ -209,6 +209,7 @@ void ScalarAdvection::initialize_scalar(const Shape& scalar_function)
     const amrex::Real y_width = m_y_width;
     const amrex::Real x_wavenumber = m_x_wavenumber;
     const amrex::Real y_wavenumber = m_y_wavenumber;
+    const int ncomp = m_scalar->num_comp();
 
     for (int level = 0; level <= m_repo.mesh().finestLevel(); ++level) {
 
@@ -224,9 +225,13 @@ void ScalarAdvection::initialize_scalar(const Shape& scalar_function)
                 nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
                     const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
                     const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
-                    scalar_arr(i, j, k, 0) = scalar_function(
+                    const amrex::Real val = scalar_function(
                         x, y, dx[0], dx[1], x0, y0, amplitude, x_width, y_width,
                         x_wavenumber, y_wavenumber);
+                    // All passive scalars start from the same shape
+                    for (int n = 0; n < ncomp; ++n) {
+                        scalar_arr(i, j, k, n) = val;
+                    }
                 });
         }
     }
@@ -1,4 +1,6 @@
+#include <cstdint>
 #include <memory>
+#include <random>
 
 #include "amr-wind/physics/SyntheticTurbulence.H"
 #include "amr-wind/CFDSim.H"
@@ -209,6 +211,260 @@ void load_turb_plane_data(
 #endif
 }
 
+/** Initialize the turbulence box and the random Fourier modes used to
+ *  synthesize the turbulence planes in-situ
+ *
+ *  The box is periodic in the streamwise (x) direction, so the x-component of
+ *  the wavenumbers is a multiple of \f$2\pi / L_x\f$. Since only two planes
+ *  are stored at any time, the box can be made as long as the simulation at
+ *  no additional cost. The modes are generated from a fixed seed on all ranks
+ *  so that every plane can be reproduced exactly, e.g., after a restart.
+ *
+ *  Anisotropy is introduced by stretching an isotropic field: with
+ *  \f$s_i = \sigma_i / \sigma_{rms}\f$ the amplitudes are scaled by
+ *  \f$s_i\f$ and the wavenumbers by \f$1/s_i\f$, which leaves
+ *  \f$\mathbf{k}_n \cdot \mathbf{a}_n = 0\f$ and the field
+ *  divergence-free. The variances match \f$\sigma_i^2\f$ in expectation, only
+ *  their sum is matched exactly.
+ *
+ *  @param pp ParmParse instance for the SynthTurb namespace
+ *  @param turb_grid Turbulence data
+ *  @param modes Fourier modes (populated by this function)
+ */
+void init_spectral_modes(
+    const amrex::ParmParse& pp,
+    SynthTurbData& turb_grid,
+    synth_turb::SpectralModes& modes)
+{
+    amrex::Vector<int> box_dims;
+    amrex::Vector<amrex::Real> box_len;
+    amrex::Vector<amrex::Real> sigma;
+    amrex::Real length_scale;
+    int num_modes = 512;
+    int seed = 0;
+    pp.getarr("box_dims", box_dims);
+    pp.getarr("box_lengths", box_len);
+    pp.getarr("sigma", sigma);
+    pp.get("length_scale", length_scale);
+    pp.query("num_modes", num_modes);
+    pp.query("seed", seed);
+    AMREX_ALWAYS_ASSERT(box_dims.size() == AMREX_SPACEDIM);
+    AMREX_ALWAYS_ASSERT(box_len.size() == AMREX_SPACEDIM);
+    AMREX_ALWAYS_ASSERT(sigma.size() == AMREX_SPACEDIM);
+    AMREX_ALWAYS_ASSERT(length_scale > 0.0);
+    AMREX_ALWAYS_ASSERT(num_modes > 0);
+
+    amrex::Real sigma_sqr = 0.0;
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        AMREX_ALWAYS_ASSERT(box_dims[i] > 1);
+        AMREX_ALWAYS_ASSERT(box_len[i] > 0.0);
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(
+            sigma[i] > 0.0, "SynthTurb.sigma must be positive");
+        turb_grid.box_dims[i] = box_dims[i];
+        turb_grid.box_len[i] = box_len[i];
+        sigma_sqr += sigma[i] * sigma[i];
+    }
+    vs::Vector stretch;
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        stretch[i] = sigma[i] / std::sqrt(sigma_sqr / AMREX_SPACEDIM);
+    }
+    // Periodic in x, the grid spans the entire box in y and z
+    turb_grid.dx[0] = box_len[0] / box_dims[0];
+    turb_grid.dx[1] = box_len[1] / (box_dims[1] - 1);
+    turb_grid.dx[2] = box_len[2] / (box_dims[2] - 1);
+
+    const size_t grid_size = 2 * box_dims[1] * box_dims[2];
+    turb_grid.uvel.resize(grid_size);
+    turb_grid.vvel.resize(grid_size);
+    turb_grid.wvel.resize(grid_size);
+    turb_grid.uvel_d.resize(grid_size);
+    turb_grid.vvel_d.resize(grid_size);
+    turb_grid.wvel_d.resize(grid_size);
+
+    // Mode magnitudes are distributed logarithmically between the largest
+    // scale of the box and the resolution of the grid
+    const amrex::Real two_pi = utils::two_pi();
+    const amrex::Real kmin =
+        two_pi / amrex::max(box_len[0], amrex::max(box_len[1], box_len[2]));
+    const amrex::Real dxmin = amrex::min(
+        turb_grid.dx[0], amrex::min(turb_grid.dx[1], turb_grid.dx[2]));
+    const amrex::Real kmax = utils::pi() / dxmin;
+    const amrex::Real dlogk = std::log(kmax / kmin) / num_modes;
+
+    // Portable uniform random numbers in [0, 1)
+    std::mt19937_64 gen(static_cast<std::uint64_t>(seed));
+    auto uniform = [&gen]() {
+        return static_cast<amrex::Real>(gen() >> 11) * 0x1.0p-53;
+    };
+    auto unit_vector = [&]() {
+        const amrex::Real cost = 2.0 * uniform() - 1.0;
+        const amrex::Real sint = std::sqrt(1.0 - cost * cost);
+        const amrex::Real phi = two_pi * uniform();
+        return vs::Vector{sint * std::cos(phi), sint * std::sin(phi), cost};
+    };
+
+    amrex::Vector<vs::Vector> wavenum(num_modes);
+    amrex::Vector<vs::Vector> amplitude(num_modes);
+    amrex::Vector<amrex::Real> phase(num_modes);
+    amrex::Real variance = 0.0;
+    for (int n = 0; n < num_modes; ++n) {
+        const amrex::Real kmag = kmin * std::exp((n + 0.5) * dlogk);
+        const amrex::Real dk = kmag * dlogk;
+
+        // von Karman energy spectrum (unscaled)
+        const amrex::Real kl2 = (kmag * length_scale) * (kmag * length_scale);
+        const amrex::Real ek = kl2 * kl2 / std::pow(1.0 + kl2, 17.0 / 6.0);
+
+        // Stretched wavenumber, the x-component is snapped to the box
+        auto kvec = kmag * unit_vector();
+        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+            kvec[i] /= stretch[i];
+        }
+        kvec[0] = two_pi / box_len[0] *
+                  std::round(kvec[0] * box_len[0] / two_pi);
+
+        // Amplitude normal to the wavenumber of the isotropic field, so that
+        // the stretched amplitude is normal to the stretched wavenumber
+        vs::Vector kiso;
+        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+            kiso[i] = stretch[i] * kvec[i];
+        }
+        vs::Vector sdir = kiso ^ unit_vector();
+        while (vs::mag_sqr(sdir) < 1.0e-12 * vs::mag_sqr(kiso)) {
+            sdir = kiso ^ unit_vector();
+        }
+        vs::Vector adir = sdir.unit();
+        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+            adir[i] *= stretch[i];
+        }
+        const amrex::Real qn = 2.0 * std::sqrt(ek * dk);
+        wavenum[n] = kvec;
+        amplitude[n] = qn * adir;
+        phase[n] = two_pi * uniform();
+
+        variance += 0.5 * vs::mag_sqr(amplitude[n]);
+    }
+
+    // A single scale factor for all components keeps the modes solenoidal
+    const amrex::Real ascale = std::sqrt(sigma_sqr / variance);
+    for (auto& amp : amplitude) {
+        amp *= ascale;
+    }
+
+    modes.wavenum.resize(num_modes);
+    modes.amplitude.resize(num_modes);
+    modes.phase.resize(num_modes);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, wavenum.begin(), wavenum.end(),
+        modes.wavenum.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, amplitude.begin(), amplitude.end(),
+        modes.amplitude.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, phase.begin(), phase.end(),
+        modes.phase.begin());
+}
+
+/** Synthesize two planes of data that bound the current timestep
+ *
+ *  If the box advanced by a single plane, the right plane is reused as the
+ *  new left plane and only one plane is synthesized. The points of the
+ *  synthesized planes are distributed across the MPI ranks and the results
+ *  are combined with a reduction.
+ */
+void generate_turb_plane_data(
+    const synth_turb::SpectralModes& modes,
+    SynthTurbData& turb_grid,
+    const int il,
+    const int ir)
+{
+    BL_PROFILE("amr-wind::SyntheticTurbulence::generate_plane_data");
+    const int nz = turb_grid.box_dims[2];
+    const int nynz = turb_grid.box_dims[1] * turb_grid.box_dims[2];
+
+    int pstart = 0;
+    if (il == turb_grid.iright) {
+        std::copy(
+            turb_grid.uvel.begin() + nynz, turb_grid.uvel.end(),
+            turb_grid.uvel.begin());
+        std::copy(
+            turb_grid.vvel.begin() + nynz, turb_grid.vvel.end(),
+            turb_grid.vvel.begin());
+        std::copy(
+            turb_grid.wvel.begin() + nynz, turb_grid.wvel.end(),
+            turb_grid.wvel.begin());
+        pstart = 1;
+    }
+
+    // Range of points synthesized on this rank
+    const int offset = pstart * nynz;
+    const int npts = (2 - pstart) * nynz;
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int myproc = amrex::ParallelDescriptor::MyProc();
+    const int pbegin = static_cast<int>(
+        (static_cast<amrex::Long>(npts) * myproc) / nprocs);
+    const int pend = static_cast<int>(
+        (static_cast<amrex::Long>(npts) * (myproc + 1)) / nprocs);
+
+    const amrex::Real xl = il * turb_grid.dx[0];
+    const amrex::Real xr = ir * turb_grid.dx[0];
+    const amrex::Real dy = turb_grid.dx[1];
+    const amrex::Real dz = turb_grid.dx[2];
+    const int num_modes = static_cast<int>(modes.phase.size());
+    const auto* wavenum = modes.wavenum.data();
+    const auto* amplitude = modes.amplitude.data();
+    const auto* phase = modes.phase.data();
+    auto* uvel = turb_grid.uvel_d.data();
+    auto* vvel = turb_grid.vvel_d.data();
+    auto* wvel = turb_grid.wvel_d.data();
+    amrex::ParallelFor(npts, [=] AMREX_GPU_DEVICE(int n) noexcept {
+        const int idx = offset + n;
+        vs::Vector vel = vs::Vector::zero();
+        if ((n >= pbegin) && (n < pend)) {
+            const int ip = idx / nynz;
+            const int j = (idx % nynz) / nz;
+            const int k = idx % nz;
+            const vs::Vector pt{(ip == 0) ? xl : xr, j * dy, k * dz};
+            for (int m = 0; m < num_modes; ++m) {
+                const amrex::Real arg = (wavenum[m] & pt) + phase[m];
+                vel = vel + amplitude[m] * std::cos(arg);
+            }
+        }
+        uvel[idx] = vel[0];
+        vvel[idx] = vel[1];
+        wvel[idx] = vel[2];
+    });
+
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, turb_grid.uvel_d.begin() + offset,
+        turb_grid.uvel_d.end(), turb_grid.uvel.begin() + offset);
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, turb_grid.vvel_d.begin() + offset,
+        turb_grid.vvel_d.end(), turb_grid.vvel.begin() + offset);
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, turb_grid.wvel_d.begin() + offset,
+        turb_grid.wvel_d.end(), turb_grid.wvel.begin() + offset);
+    amrex::ParallelDescriptor::ReduceRealSum(
+        &turb_grid.uvel[offset], npts);
+    amrex::ParallelDescriptor::ReduceRealSum(
+        &turb_grid.vvel[offset], npts);
+    amrex::ParallelDescriptor::ReduceRealSum(
+        &turb_grid.wvel[offset], npts);
+
+    turb_grid.ileft = il;
+    turb_grid.iright = ir;
+
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, turb_grid.uvel.begin(), turb_grid.uvel.end(),
+        turb_grid.uvel_d.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, turb_grid.vvel.begin(), turb_grid.vvel.end(),
+        turb_grid.vvel_d.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, turb_grid.wvel.begin(), turb_grid.wvel.end(),
+        turb_grid.wvel_d.begin());
+}
+
 /** Determine the left/right indices for a given point along a particular
  * direction
  *
@@ -358,17 +614,26 @@ SyntheticTurbulence::SyntheticTurbulence(const CFDSim& sim)
     , m_density(sim.repo().get_field("density"))
     , m_turb_force(sim.repo().declare_field("synth_turb_forcing", 3))
 {
-#ifndef AMR_WIND_USE_NETCDF
-    amrex::Abort(
-        "SyntheticTurbulence: AMR-Wind was not built with NetCDF support.");
-#endif
     const amrex::Real pi = std::acos(-1.0);
 
     amrex::ParmParse pp("SynthTurb");
 
-    // NetCDF file containing the turbulence data
-    pp.query("turbulence_file", m_turb_filename);
-    process_nc_file(m_turb_filename, m_turb_grid);
+    pp.query("generator", m_generator);
+    if (m_generator == "file") {
+#ifndef AMR_WIND_USE_NETCDF
+        amrex::Abort(
+            "SyntheticTurbulence: AMR-Wind was not built with NetCDF support.");
+#endif
+        // NetCDF file containing the turbulence data
+        pp.query("turbulence_file", m_turb_filename);
+        process_nc_file(m_turb_filename, m_turb_grid);
+    } else if (m_generator == "spectral") {
+        init_spectral_modes(pp, m_turb_grid, m_modes);
+    } else {
+        amrex::Abort(
+            "SyntheticTurbulence: invalid generator specified = " +
+            m_generator);
+    }
 
     // Load position and orientation of the grid
     amrex::Real wind_direction{270.};
@@ -459,7 +724,13 @@ SyntheticTurbulence::SyntheticTurbulence(const CFDSim& sim)
     m_turb_grid.tr_mat = vs::zrot(270.0 - wind_direction);
 
     amrex::Print() << "Synthetic turbulence forcing initialized \n"
-                   << "  Turbulence file = " << m_turb_filename << "\n"
+                   << "  Turbulence "
+                   << ((m_generator == "file")
+                           ? "file = " + m_turb_filename
+                           : "generator = spectral with " +
+                                 std::to_string(m_modes.phase.size()) +
+                                 " modes")
+                   << "\n"
                    << "  Box lengths = [" << m_turb_grid.box_len[0] << ", "
                    << m_turb_grid.box_len[1] << ", " << m_turb_grid.box_len[2]
                    << "]\n"
@@ -499,7 +770,7 @@ void SyntheticTurbulence::initialize()
     const amrex::Real eqivLen = m_wind_profile->reference_velocity() * curTime;
     int il, ir;
     get_lr_indices(m_turb_grid, 0, eqivLen, il, ir);
-    load_turb_plane_data(m_turb_filename, m_turb_grid, il, ir);
+    load_planes(il, ir);
 
     m_is_init = false;
 }
@@ -529,8 +800,7 @@ void SyntheticTurbulence::update()
 
     // Check if we need to refresh the planes
     if (weights.il != m_turb_grid.ileft) {
-        load_turb_plane_data(
-            m_turb_filename, m_turb_grid, weights.il, weights.ir);
+        load_planes(weights.il, weights.ir);
     }
 
     if (m_mean_wind_type == "ConstValue") {
@@ -550,6 +820,15 @@ void SyntheticTurbulence::update()
     }
 }
 
+void SyntheticTurbulence::load_planes(const int il, const int ir)
+{
+    if (m_generator == "spectral") {
+        generate_turb_plane_data(m_modes, m_turb_grid, il, ir);
+    } else {
+        load_turb_plane_data(m_turb_filename, m_turb_grid, il, ir);
+    }
+}
+
 template <typename T>
 void SyntheticTurbulence::update_impl(
     const SynthTurbDeviceData& turb_grid,
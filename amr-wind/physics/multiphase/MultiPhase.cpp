@@ -23,6 +23,7 @@ MultiPhase::MultiPhase(CFDSim& sim)
     pp_multiphase.query("verbose", m_verbose);
     pp_multiphase.query("interface_smoothing", m_interface_smoothing);
     pp_multiphase.query("interface_smoothing_frequency", m_smooth_freq);
+    pp_multiphase.query("load_balance_weight", m_load_balance_weight);
 
     // Register either the VOF or levelset equation
     if (amrex::toLower(m_interface_model) == "vof") {
@@ -520,4 +521,35 @@ void MultiPhase::levelset2vof()
     (*m_vof).fillpatch(0.0);
 }
 
+void MultiPhase::add_load_balance_cost(int lev, amrex::MultiFab& cost) const
+{
+    if (m_load_balance_weight <= 0.0) {
+        return;
+    }
+
+    // Interface cells: mixed VOF cells or levelset within 1.5 cells
+    const bool use_vof =
+        (m_interface_capturing_method == InterfaceCapturingMethod::VOF);
+    const auto& fld = use_vof ? (*m_vof)(lev) : (*m_levelset)(lev);
+    const auto& dx = m_sim.mesh().Geom(lev).CellSizeArray();
+    const amrex::Real band =
+        1.5 * amrex::min(AMREX_D_DECL(dx[0], dx[1], dx[2]));
+    constexpr amrex::Real vof_tol = 1.0e-12;
+    const amrex::Real weight = m_load_balance_weight;
+    for (amrex::MFIter mfi(cost); mfi.isValid(); ++mfi) {
+        const auto& bx = mfi.validbox();
+        const auto& carr = cost.array(mfi);
+        const auto& farr = fld.const_array(mfi);
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            const amrex::Real phi = farr(i, j, k);
+            const bool in_band =
+                use_vof ? ((phi > vof_tol) && (phi < 1.0 - vof_tol))
+                        : (std::abs(phi) < band);
+            if (in_band) {
+                carr(i, j, k) += weight;
+            }
+        });
+    }
+}
+
 } // namespace amr_wind
@@ -3,7 +3,9 @@
 #include "amr-wind/incflo.H"
 #include "amr-wind/core/MLMGOptions.H"
 #include "amr-wind/utilities/console_io.H"
+#include "amr-wind/utilities/PerfReport.H"
 #include "amr-wind/core/field_ops.H"
+#include "amr-wind/core/VelocityGradient.H"
 #include "amr-wind/wind_energy/ABL.H"
 
 using namespace amrex;
@@ -53,6 +55,13 @@ incflo::get_projection_bc(Orientation::Side side) const noexcept
     return r;
 }
 
+void incflo::reset_nodal_projector()
+{
+    m_nodal_projector.reset();
+    m_nodal_proj_sigma.clear();
+    m_nodal_proj_vel.clear();
+}
+
 /** Perform nodal projection
  *
  *  Computes the following decomposition:
@@ -110,6 +119,7 @@ void incflo::ApplyProjection(
     bool incremental)
 {
     BL_PROFILE("amr-wind::incflo::ApplyProjection");
+    amr_wind::perf::ScopedTimer perf_timer(amr_wind::perf::Region::projection);
 
     // If we have dropped the dt substantially for whatever reason,
     // use a different form of the approximate projection that
@@ -247,14 +257,33 @@ void incflo::ApplyProjection(
         velocity.to_uniform_space();
     }
 
+    // The persistent projector is reused until the next regrid. Immersed
+    // boundaries and overset meshes change the right hand side or the masks
+    // every step and always use a new projector.
+    bool has_ib = m_sim.physics_manager().contains("IB");
+    const bool persistent =
+        m_persistent_nodal_proj && !has_ib && !m_sim.has_overset();
+    const bool var_sigma = variable_density || mesh_mapping;
+
+    // The persistent projector solves for dt * phi so that its coefficients
+    // do not depend on the timestep size
+    const Real sigma_scale = persistent ? 1.0 : scaling_factor;
+
     // Create sigma while accounting for mesh mapping
     // sigma = 1/(fac^2)*J * dt/rho
-    Vector<amrex::MultiFab> sigma(finest_level + 1);
-    if (variable_density || mesh_mapping) {
+    Vector<amrex::MultiFab> sigma_local;
+    Vector<amrex::MultiFab>& sigma =
+        persistent ? m_nodal_proj_sigma : sigma_local;
+    if (var_sigma) {
         int ncomp = mesh_mapping ? AMREX_SPACEDIM : 1;
+        sigma.resize(finest_level + 1);
         for (int lev = 0; lev <= finest_level; ++lev) {
-            sigma[lev].define(
-                grids[lev], dmap[lev], ncomp, 0, MFInfo(), Factory(lev));
+            if (!sigma[lev].ok() || (sigma[lev].nComp() != ncomp) ||
+                (sigma[lev].boxArray() != grids[lev]) ||
+                (sigma[lev].DistributionMap() != dmap[lev])) {
+                sigma[lev].define(
+                    grids[lev], dmap[lev], ncomp, 0, MFInfo(), Factory(lev));
+            }
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
@@ -281,7 +310,7 @@ void incflo::ApplyProjection(
                         amrex::Real det_j =
                             mesh_mapping ? (detJ(i, j, k)) : 1.0;
                         sig(i, j, k, n) = std::pow(fac_cc, -2.) * det_j *
-                                          scaling_factor / rho(i, j, k);
+                                          sigma_scale / rho(i, j, k);
                         if (is_anelastic) {
                             sig(i, j, k, n) *= ref_rho(i, j, k);
                         }
@@ -291,7 +320,7 @@ void incflo::ApplyProjection(
     }
 
     // Perform projection
-    std::unique_ptr<Hydro::NodalProjector> nodal_projector;
+    std::unique_ptr<Hydro::NodalProjector> nodal_projector_local;
 
     auto bclo = get_projection_bc(Orientation::low);
     auto bchi = get_projection_bc(Orientation::high);
@@ -315,25 +344,44 @@ void incflo::ApplyProjection(
 
     amr_wind::MLMGOptions options("nodal_proj");
 
-    if (variable_density || mesh_mapping) {
-        nodal_projector = std::make_unique<Hydro::NodalProjector>(
-            vel, GetVecOfConstPtrs(sigma), Geom(0, finest_level),
-            options.lpinfo());
+    auto& projector_ptr =
+        persistent ? m_nodal_projector : nodal_projector_local;
+    // The projector keeps pointers to the velocity data, which move when new
+    // fields are declared
+    const bool reuse = persistent && (m_nodal_projector != nullptr) &&
+                       (m_nodal_proj_var_sigma == var_sigma) &&
+                       (m_nodal_proj_vel == vel);
+    if (reuse) {
+        // Only the density coefficients change between projections
+        if (var_sigma) {
+            auto& linop = m_nodal_projector->getLinOp();
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                linop.setSigma(lev, sigma[lev]);
+            }
+        }
     } else {
-        amrex::Real rho_0 = 1.0;
-        amrex::ParmParse pp("incflo");
-        pp.query("density", rho_0);
+        if (var_sigma) {
+            projector_ptr = std::make_unique<Hydro::NodalProjector>(
+                vel, GetVecOfConstPtrs(sigma), Geom(0, finest_level),
+                options.lpinfo());
+        } else {
+            amrex::Real rho_0 = 1.0;
+            amrex::ParmParse pp("incflo");
+            pp.query("density", rho_0);
 
-        nodal_projector = std::make_unique<Hydro::NodalProjector>(
-            vel, scaling_factor / rho_0, Geom(0, finest_level),
-            options.lpinfo());
-    }
+            projector_ptr = std::make_unique<Hydro::NodalProjector>(
+                vel, sigma_scale / rho_0, Geom(0, finest_level),
+                options.lpinfo());
+        }
 
-    // Set MLMG and NodalProjector options
-    options(*nodal_projector);
-    nodal_projector->setDomainBC(bclo, bchi);
+        // Set MLMG and NodalProjector options
+        options(*projector_ptr);
+        projector_ptr->setDomainBC(bclo, bchi);
+        m_nodal_proj_var_sigma = var_sigma;
+        m_nodal_proj_vel = vel;
+    }
+    auto* nodal_projector = projector_ptr.get();
 
-    bool has_ib = m_sim.physics_manager().contains("IB");
     if (has_ib) {
         auto div_vel_rhs =
             sim().repo().create_scratch_field(1, 0, amr_wind::FieldLoc::NODE);
@@ -358,7 +406,10 @@ void incflo::ApplyProjection(
         }
     }
 
-    if (m_sim.has_overset()) {
+    const bool warm_start = persistent && m_nodal_proj_warm_start;
+    if (m_sim.has_overset() || warm_start) {
+        // Start from the previous pressure, which is the solution of the last
+        // projection (scaled by dt for the persistent projector)
         auto phif = m_repo.create_scratch_field(1, 1, amr_wind::FieldLoc::NODE);
         if (incremental) {
             for (int lev = 0; lev <= finestLevel(); ++lev) {
@@ -366,8 +417,24 @@ void incflo::ApplyProjection(
             }
         } else {
             amr_wind::field_ops::copy(*phif, pressure, 0, 0, 1, 1);
+            if (warm_start) {
+                const bool has_p0 = m_reconstruct_true_pressure && time != 0.0;
+                for (int lev = 0; lev <= finest_level; ++lev) {
+                    if (has_p0) {
+                        const auto& p0 = m_repo.get_field("reference_pressure");
+                        amrex::MultiFab::Subtract(
+                            (*phif)(lev), p0(lev), 0, 0, 1, 0);
+                    }
+                    (*phif)(lev).mult(scaling_factor, 0, 1, 1);
+                }
+            }
         }
 
+        // Measure convergence relative to the right hand side so that the
+        // initial guess reduces the number of V-cycles
+        if (warm_start) {
+            nodal_projector->getMLMG().setAlwaysUseBNorm(1);
+        }
         nodal_projector->project(
             phif->vec_ptrs(), options.rel_tol, options.abs_tol);
     } else {
@@ -401,6 +468,7 @@ void incflo::ApplyProjection(
     // Get phi and fluxes
     auto phi = nodal_projector->getPhi();
     auto gradphi = nodal_projector->getGradPhi();
+    const Real phi_fac = persistent ? 1.0 / scaling_factor : 1.0;
 
     for (int lev = 0; lev <= finest_level; lev++) {
 
@@ -418,21 +486,21 @@ void incflo::ApplyProjection(
                 amrex::ParallelFor(
                     tbx, AMREX_SPACEDIM,
                     [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                        gp_lev(i, j, k, n) += gp_proj(i, j, k, n);
+                        gp_lev(i, j, k, n) += phi_fac * gp_proj(i, j, k, n);
                     });
                 amrex::ParallelFor(
                     nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        p_lev(i, j, k) += p_proj(i, j, k);
+                        p_lev(i, j, k) += phi_fac * p_proj(i, j, k);
                     });
             } else {
                 amrex::ParallelFor(
                     tbx, AMREX_SPACEDIM,
                     [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                        gp_lev(i, j, k, n) = gp_proj(i, j, k, n);
+                        gp_lev(i, j, k, n) = phi_fac * gp_proj(i, j, k, n);
                     });
                 amrex::ParallelFor(
                     nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        p_lev(i, j, k) = p_proj(i, j, k);
+                        p_lev(i, j, k) = phi_fac * p_proj(i, j, k);
                     });
             }
         }
@@ -453,6 +521,7 @@ void incflo::ApplyProjection(
     }
 
     velocity.fillpatch(m_time.new_time());
+    m_sim.velocity_gradient().invalidate();
     if (m_verbose > 2) {
         if (proj_for_small_dt) {
             PrintMaxValues("after projection (small dt mod)");
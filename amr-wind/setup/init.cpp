@@ -3,6 +3,7 @@
 #include <cmath>
 
 #include "amr-wind/core/Physics.H"
+#include "amr-wind/core/VelocityGradient.H"
 #include "amr-wind/wind_energy/ABL.H"
 #include "amr-wind/physics/BoussinesqBubble.H"
 #include "amr-wind/utilities/tagging/RefinementCriteria.H"
@@ -20,6 +21,13 @@ void incflo::ReadParameters()
 
         pp.query("verbose", m_verbose);
 
+        bool use_scratch_pool = true;
+        pp.query("scratch_field_pool", use_scratch_pool);
+        m_repo.scratch_pool().set_enabled(use_scratch_pool);
+
+        pp.query("persistent_nodal_projector", m_persistent_nodal_proj);
+        pp.query("nodal_projector_warm_start", m_nodal_proj_warm_start);
+
         pp.query("initial_iterations", m_initial_iterations);
         pp.query("do_initial_proj", m_do_initial_proj);
 
@@ -80,6 +88,7 @@ void incflo::InitialIterations()
         auto& vel = icns().fields().field;
         vel.copy_state(amr_wind::FieldState::Old, amr_wind::FieldState::New);
         vel.state(amr_wind::FieldState::Old).fillpatch(m_time.current_time());
+        m_sim.velocity_gradient().invalidate();
 
         if (m_sim.pde_manager().constant_density()) {
             auto& rho = density();
@@ -113,6 +122,7 @@ void incflo::InitialIterations()
             }
             vel.copy_state(
                 amr_wind::FieldState::New, amr_wind::FieldState::Old);
+            m_sim.velocity_gradient().invalidate();
 
             if (m_sim.pde_manager().constant_density()) {
                 auto& rho = density();
@@ -1,7 +1,7 @@
 #include <AMReX_Config.H>
 #include <cmath>
 
-#include "amr-wind/fvm/gradient.H"
+#include "amr-wind/core/VelocityGradient.H"
 #include "amr-wind/turbulence/LES/AMDNoTherm.H"
 #include "amr-wind/turbulence/TurbModelDefs.H"
 
@@ -16,7 +16,6 @@ template <typename Transport>
 // cppcheck-suppress uninitMemberVar
 AMDNoTherm<Transport>::AMDNoTherm(CFDSim& sim)
     : TurbModelBase<Transport>(sim)
-    , m_vel(sim.repo().get_field("velocity"))
     , m_rho(sim.repo().get_field("density"))
 {}
 
@@ -37,10 +36,8 @@ void AMDNoTherm<Transport>::update_turbulent_viscosity(
 
     auto& mu_turb = this->mu_turb();
     const auto& repo = mu_turb.repo();
-    const auto& vel = m_vel.state(fstate);
     const auto& den = m_rho.state(fstate);
-    auto gradVel = repo.create_scratch_field(AMREX_SPACEDIM * AMREX_SPACEDIM);
-    fvm::gradient(*gradVel, vel);
+    auto& vel_grad = this->m_sim.velocity_gradient();
     const auto& geom_vec = repo.mesh().Geom();
 
     const amrex::Real C_poincare = this->m_C;
@@ -50,9 +47,10 @@ void AMDNoTherm<Transport>::update_turbulent_viscosity(
         const auto& geom = geom_vec[lev];
 
         const auto& dx = geom.CellSizeArray();
+        const auto& gradVel = vel_grad(lev, fstate);
         for (amrex::MFIter mfi(mu_turb(lev)); mfi.isValid(); ++mfi) {
             const auto& bx = mfi.tilebox();
-            const auto& gradVel_arr = (*gradVel)(lev).array(mfi);
+            const auto& gradVel_arr = gradVel.const_array(mfi);
             const auto& mu_arr = mu_turb(lev).array(mfi);
             const auto& rho_arr = den(lev).const_array(mfi);
             amrex::ParallelFor(
@@ -2,7 +2,7 @@
 #include "amr-wind/equation_systems/PDEBase.H"
 #include "amr-wind/turbulence/TurbModelDefs.H"
 #include "amr-wind/fvm/gradient.H"
-#include "amr-wind/fvm/strainrate.H"
+#include "amr-wind/core/VelocityGradient.H"
 #include "amr-wind/turbulence/turb_utils.H"
 #include "amr-wind/equation_systems/tke/TKE.H"
 
@@ -95,9 +95,8 @@ void OneEqKsgsM84<Transport>::update_turbulent_viscosity(
     auto gradT = (this->m_sim.repo()).create_scratch_field(3, 0);
     fvm::gradient(*gradT, m_temperature.state(fstate));
 
-    const auto& vel = this->m_vel.state(fstate);
     // Compute strain rate into shear production term
-    fvm::strainrate(this->m_shear_prod, vel);
+    this->m_sim.velocity_gradient().strainrate(this->m_shear_prod, fstate);
 
     const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> gravity{
         {m_gravity[0], m_gravity[1], m_gravity[2]}};
@@ -210,9 +209,9 @@ void OneEqKsgsM84<Transport>::update_scalar_diff(
 
     if (name == pde::TKE::var_name()) {
         auto& mu_turb = this->mu_turb();
-        deff.setVal(0.0);
-        field_ops::saxpy(
-            deff, 2.0, mu_turb, 0, 0, deff.num_comp(), deff.num_grow());
+        field_ops::assign(
+            deff, 2.0 * field_ops::term(mu_turb), 0, deff.num_comp(),
+            deff.num_grow());
     } else {
         amrex::Abort(
             "OneEqKsgsM84:update_scalar_diff not implemented for field " +
@@ -304,9 +303,9 @@ void OneEqKsgsS94<Transport>::update_scalar_diff(
 
     if (name == pde::TKE::var_name()) {
         auto& mu_turb = this->mu_turb();
-        deff.setVal(0.0);
-        field_ops::saxpy(
-            deff, 2.0, mu_turb, 0, 0, deff.num_comp(), deff.num_grow());
+        field_ops::assign(
+            deff, 2.0 * field_ops::term(mu_turb), 0, deff.num_comp(),
+            deff.num_grow());
     } else {
         amrex::Abort(
             "OneEqKsgsM84:update_scalar_diff not implemented for field " +
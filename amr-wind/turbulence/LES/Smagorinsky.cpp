@@ -2,7 +2,7 @@
 
 #include "amr-wind/turbulence/LES/Smagorinsky.H"
 #include "amr-wind/turbulence/TurbModelDefs.H"
-#include "amr-wind/fvm/strainrate.H"
+#include "amr-wind/core/VelocityGradient.H"
 #include "AMReX_REAL.H"
 #include "AMReX_MultiFab.H"
 #include "AMReX_ParmParse.H"
@@ -14,7 +14,6 @@ template <typename Transport>
 // cppcheck-suppress uninitMemberVar
 Smagorinsky<Transport>::Smagorinsky(CFDSim& sim)
     : TurbModelBase<Transport>(sim)
-    , m_vel(sim.repo().get_field("velocity"))
     , m_rho(sim.repo().get_field("density"))
 {}
 
@@ -27,14 +26,13 @@ void Smagorinsky<Transport>::update_turbulent_viscosity(
 
     auto& mu_turb = this->mu_turb();
     const auto& repo = mu_turb.repo();
-    const auto& vel = m_vel.state(fstate);
     const auto& den = m_rho.state(fstate);
     const auto& geom_vec = repo.mesh().Geom();
     const amrex::Real Cs_sqr = this->m_Cs * this->m_Cs;
 
     // Populate strainrate into the turbulent viscosity arrays to avoid creating
     // a temporary buffer
-    fvm::strainrate(mu_turb, vel);
+    this->m_sim.velocity_gradient().strainrate(mu_turb, fstate);
 
     const int nlevels = repo.num_active_levels();
     for (int lev = 0; lev < nlevels; ++lev) {
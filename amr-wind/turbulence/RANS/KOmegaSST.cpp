@@ -3,7 +3,7 @@
 #include "amr-wind/equation_systems/PDEBase.H"
 #include "amr-wind/turbulence/TurbModelDefs.H"
 #include "amr-wind/fvm/gradient.H"
-#include "amr-wind/fvm/strainrate.H"
+#include "amr-wind/core/VelocityGradient.H"
 #include "amr-wind/turbulence/turb_utils.H"
 #include "amr-wind/equation_systems/tke/TKE.H"
 #include "amr-wind/equation_systems/sdr/SDR.H"
@@ -101,9 +101,8 @@ void KOmegaSST<Transport>::update_turbulent_viscosity(
     auto gradden = (this->m_sim.repo()).create_scratch_field(3, 0);
     fvm::gradient(*gradden, den);
 
-    const auto& vel = this->m_vel.state(fstate);
     // Compute strain rate into shear production term
-    fvm::strainrate(this->m_shear_prod, vel);
+    this->m_sim.velocity_gradient().strainrate(this->m_shear_prod, fstate);
 
     const amrex::Real deltaT = (this->m_sim).time().deltaT();
     const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> gravity{
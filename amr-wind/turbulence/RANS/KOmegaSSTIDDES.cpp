@@ -3,9 +3,7 @@
 #include "amr-wind/equation_systems/PDEBase.H"
 #include "amr-wind/turbulence/TurbModelDefs.H"
 #include "amr-wind/fvm/gradient.H"
-#include "amr-wind/fvm/strainrate.H"
-#include "amr-wind/fvm/vorticity.H"
-#include "amr-wind/fvm/vorticity_mag.H"
+#include "amr-wind/core/VelocityGradient.H"
 #include "amr-wind/turbulence/turb_utils.H"
 #include "amr-wind/equation_systems/tke/TKE.H"
 #include "amr-wind/equation_systems/sdr/SDR.H"
@@ -112,12 +110,9 @@ void KOmegaSSTIDDES<Transport>::update_turbulent_viscosity(
     auto gradOmega = (this->m_sim.repo()).create_scratch_field(3, 0);
     fvm::gradient(*gradOmega, sdr);
 
-    const auto& vel = this->m_vel.state(fstate);
     // Compute strain rate into shear production term
-    fvm::strainrate(this->m_shear_prod, vel);
-
-    auto vortmag = (this->m_sim.repo()).create_scratch_field(1, 0);
-    fvm::vorticity_mag(*vortmag, vel);
+    auto& vel_grad = this->m_sim.velocity_gradient();
+    vel_grad.strainrate(this->m_shear_prod, fstate);
 
     const amrex::Real deltaT = (this->m_sim).time().deltaT();
 
@@ -129,6 +124,7 @@ void KOmegaSSTIDDES<Transport>::update_turbulent_viscosity(
         const amrex::Real dz = geom.CellSize()[2];
         const amrex::Real hmax =
             amrex::max<amrex::Real>(amrex::max<amrex::Real>(dx, dy), dz);
+        const auto& grad_vel = vel_grad(lev, fstate);
 
         for (amrex::MFIter mfi(mu_turb(lev)); mfi.isValid(); ++mfi) {
             const auto& bx = mfi.tilebox();
@@ -141,7 +137,7 @@ void KOmegaSSTIDDES<Transport>::update_turbulent_viscosity(
             const auto& sdr_arr = sdr(lev).array(mfi);
             const auto& wd_arr = (this->m_walldist)(lev).array(mfi);
             const auto& shear_prod_arr = (this->m_shear_prod)(lev).array(mfi);
-            const auto& vortmag_arr = (*vortmag)(lev).const_array(mfi);
+            const auto& grad_vel_arr = grad_vel.const_array(mfi);
             const auto& rans_ind_arr = (this->m_rans_ind)(lev).array(mfi);
             const auto& diss_arr = (this->m_diss)(lev).array(mfi);
             const auto& sdr_src_arr = (this->m_sdr_src)(lev).array(mfi);
@@ -175,7 +171,8 @@ void KOmegaSSTIDDES<Transport>::update_turbulent_viscosity(
                              rho_arr(i, j, k) +
                          1e-15);
                     amrex::Real tmp4 = shear_prod_arr(i, j, k);
-                    amrex::Real tmp5 = vortmag_arr(i, j, k);
+                    amrex::Real tmp5 =
+                        VelocityGradient::vorticity_mag(grad_vel_arr, i, j, k);
 
                     amrex::Real arg1 = amrex::min<amrex::Real>(
                         amrex::max<amrex::Real>(tmp2, tmp3), tmp1);
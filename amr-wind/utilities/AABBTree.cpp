@@ -0,0 +1,125 @@
+#include "amr-wind/utilities/AABBTree.H"
+
+#include <algorithm>
+#include <numeric>
+
+#include "AMReX.H"
+
+namespace amr_wind::utils {
+
+namespace {
+
+//! Smallest box containing both `a` and `b`
+amrex::RealBox merge(const amrex::RealBox& a, const amrex::RealBox& b)
+{
+    amrex::RealBox res;
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        res.setLo(i, amrex::min(a.lo(i), b.lo(i)));
+        res.setHi(i, amrex::max(a.hi(i), b.hi(i)));
+    }
+    return res;
+}
+
+//! Check if two boxes overlap, boxes that touch are considered overlapping
+bool overlaps(const amrex::RealBox& a, const amrex::RealBox& b)
+{
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        if ((a.lo(i) > b.hi(i)) || (a.hi(i) < b.lo(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+AABBTree::AABBTree(
+    const amrex::Vector<amrex::RealBox>& boxes, const int leaf_size)
+    : m_leaf_size(leaf_size)
+{
+    AMREX_ALWAYS_ASSERT(m_leaf_size > 0);
+    build(boxes);
+}
+
+void AABBTree::build(const amrex::Vector<amrex::RealBox>& boxes)
+{
+    m_boxes = boxes;
+    m_order.resize(m_boxes.size());
+    std::iota(m_order.begin(), m_order.end(), 0);
+    m_nodes.clear();
+    if (!m_boxes.empty()) {
+        m_nodes.reserve(2 * m_boxes.size() / m_leaf_size + 1);
+        build_node(0, size());
+    }
+}
+
+int AABBTree::build_node(const int begin, const int end)
+{
+    const int inode = num_nodes();
+    m_nodes.emplace_back();
+
+    amrex::RealBox bbox = m_boxes[m_order[begin]];
+    for (int i = begin + 1; i < end; ++i) {
+        bbox = merge(bbox, m_boxes[m_order[i]]);
+    }
+    m_nodes[inode].bbox = bbox;
+    m_nodes[inode].begin = begin;
+    m_nodes[inode].end = end;
+
+    if ((end - begin) <= m_leaf_size) {
+        return inode;
+    }
+
+    // Split at the median of the centroids along the longest extent
+    int dir = 0;
+    for (int i = 1; i < AMREX_SPACEDIM; ++i) {
+        if (bbox.length(i) > bbox.length(dir)) {
+            dir = i;
+        }
+    }
+    const int mid = begin + (end - begin) / 2;
+    std::nth_element(
+        m_order.begin() + begin, m_order.begin() + mid, m_order.begin() + end,
+        [&](const int a, const int b) {
+            return (m_boxes[a].lo(dir) + m_boxes[a].hi(dir)) <
+                   (m_boxes[b].lo(dir) + m_boxes[b].hi(dir));
+        });
+
+    const int left = build_node(begin, mid);
+    const int right = build_node(mid, end);
+    m_nodes[inode].left = left;
+    m_nodes[inode].right = right;
+    return inode;
+}
+
+void AABBTree::query(
+    const amrex::RealBox& bx, amrex::Vector<int>& indices) const
+{
+    indices.clear();
+    if (m_nodes.empty()) {
+        return;
+    }
+
+    amrex::Vector<int> stack{0};
+    while (!stack.empty()) {
+        const auto& node = m_nodes[stack.back()];
+        stack.pop_back();
+        if (!overlaps(node.bbox, bx)) {
+            continue;
+        }
+
+        if (node.left < 0) {
+            for (int i = node.begin; i < node.end; ++i) {
+                if (overlaps(m_boxes[m_order[i]], bx)) {
+                    indices.push_back(m_order[i]);
+                }
+            }
+        } else {
+            stack.push_back(node.left);
+            stack.push_back(node.right);
+        }
+    }
+    std::sort(indices.begin(), indices.end());
+}
+
+} // namespace amr_wind::utils
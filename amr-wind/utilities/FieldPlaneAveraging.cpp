@@ -252,6 +252,19 @@ void FPlaneAveraging<FType>::operator()()
     }
 }
 
+template <typename FType>
+void FPlaneAveraging<FType>::set_line_average(
+    const amrex::Vector<amrex::Real>& avg)
+{
+    AMREX_ALWAYS_ASSERT(avg.size() == m_line_average.size());
+    m_last_updated_index = m_time.time_index();
+    std::copy(avg.begin(), avg.end(), m_line_average.begin());
+
+    if (m_comp_deriv) {
+        compute_line_derivatives();
+    }
+}
+
 template <typename FType>
 template <typename IndexSelector>
 void FPlaneAveraging<FType>::compute_averages(
@@ -422,6 +435,17 @@ void VelPlaneAveraging::compute_hvelmag_averages(
         static_cast<int>(m_line_hvelmag_average.size()));
 }
 
+void VelPlaneAveraging::set_line_hvelmag_average(
+    const amrex::Vector<amrex::Real>& avg)
+{
+    AMREX_ALWAYS_ASSERT(avg.size() == m_line_hvelmag_average.size());
+    std::copy(avg.begin(), avg.end(), m_line_hvelmag_average.begin());
+
+    if (m_comp_deriv) {
+        compute_line_hvelmag_derivatives();
+    }
+}
+
 void VelPlaneAveraging::compute_line_hvelmag_derivatives()
 {
     BL_PROFILE("amr-wind::VelPlaneAveraging::compute_line_hvelmag_derivatives");
@@ -0,0 +1,461 @@
+#include "amr-wind/utilities/FusedPlaneAveraging.H"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+namespace amr_wind {
+
+FusedPlaneAveraging::FusedPlaneAveraging(int axis_in) : m_axis(axis_in)
+{
+    AMREX_ALWAYS_ASSERT(m_axis >= 0 && m_axis < AMREX_SPACEDIM);
+}
+
+int FusedPlaneAveraging::field_index(FieldPlaneAveraging& pa)
+{
+    auto it = std::find(m_fields.begin(), m_fields.end(), &pa);
+    if (it != m_fields.end()) {
+        return static_cast<int>(it - m_fields.begin());
+    }
+
+    AMREX_ALWAYS_ASSERT(pa.axis() == m_axis);
+    AMREX_ALWAYS_ASSERT(static_cast<int>(m_fields.size()) < max_fields);
+    if (m_fields.empty()) {
+        m_ncell_line = pa.ncell_line();
+        m_ncell_plane = pa.ncell_plane();
+    } else {
+        const auto& pa0 = *m_fields[0];
+        AMREX_ALWAYS_ASSERT(pa.level() == pa0.level());
+        AMREX_ALWAYS_ASSERT(pa.ncell_line() == m_ncell_line);
+        AMREX_ALWAYS_ASSERT(pa.ncell_plane() == m_ncell_plane);
+        AMREX_ALWAYS_ASSERT(
+            pa.field()(pa.level()).boxArray() ==
+            pa0.field()(pa0.level()).boxArray());
+        AMREX_ALWAYS_ASSERT(
+            pa.field()(pa.level()).DistributionMap() ==
+            pa0.field()(pa0.level()).DistributionMap());
+    }
+
+    const int fidx = static_cast<int>(m_fields.size());
+    m_fields.push_back(&pa);
+
+    // Register the means of all the components
+    for (int n = 0; n < pa.ncomp(); ++n) {
+        const int fld[3] = {fidx, 0, 0};
+        const int comp[3] = {n, 0, 0};
+        add_term(1, fld, comp);
+    }
+
+    return fidx;
+}
+
+FusedPlaneAveraging::TermKey
+FusedPlaneAveraging::add_term(int nfac, const int* fld, const int* comp)
+{
+    AvgTerm term;
+    term.nfac = nfac;
+    for (int q = 0; q < 3; ++q) {
+        term.fld[q] = fld[q];
+        term.comp[q] = comp[q];
+    }
+    // Products are commutative, store factors in a canonical order
+    if (nfac > 1) {
+        for (int q = 1; q < nfac; ++q) {
+            for (int r = q; r > 0; --r) {
+                if (std::make_pair(term.fld[r], term.comp[r]) <
+                    std::make_pair(term.fld[r - 1], term.comp[r - 1])) {
+                    std::swap(term.fld[r], term.fld[r - 1]);
+                    std::swap(term.comp[r], term.comp[r - 1]);
+                }
+            }
+        }
+    }
+    const TermKey key{
+        term.nfac,    term.fld[0], term.comp[0], term.fld[1],
+        term.comp[1], term.fld[2], term.comp[2]};
+
+    if (m_term_map.count(key) == 0) {
+        auto& terms = (nfac > 1) ? m_prod_terms : m_base_terms;
+        m_term_map[key] = static_cast<int>(terms.size());
+        terms.push_back(term);
+        m_terms_dirty = true;
+    }
+    return key;
+}
+
+int FusedPlaneAveraging::term_index(const TermKey& key) const
+{
+    const int idx = m_term_map.at(key);
+    return (std::get<0>(key) > 1)
+               ? static_cast<int>(m_base_terms.size()) + idx
+               : idx;
+}
+
+void FusedPlaneAveraging::add(FieldPlaneAveraging& pa) { field_index(pa); }
+
+void FusedPlaneAveraging::add(VelPlaneAveraging& pa)
+{
+    const int fidx = field_index(pa);
+    if (std::find(m_vel.begin(), m_vel.end(), &pa) != m_vel.end()) {
+        return;
+    }
+    m_vel.push_back(&pa);
+
+    const int h1 = (m_axis == 0) ? 1 : 0;
+    const int h2 = (m_axis == 2) ? 1 : 2;
+    const int fld[3] = {fidx, fidx, 0};
+    const int comp[3] = {h1, h2, 0};
+    add_term(0, fld, comp);
+}
+
+void FusedPlaneAveraging::add(SecondMomentAveraging& sm)
+{
+    auto& pa1 = sm.plane_average1();
+    auto& pa2 = sm.plane_average2();
+    const int f1 = field_index(pa1);
+    const int f2 = field_index(pa2);
+    m_second.push_back(&sm);
+
+    for (int m = 0; m < pa1.ncomp(); ++m) {
+        for (int n = 0; n < pa2.ncomp(); ++n) {
+            const int fld[3] = {f1, f2, 0};
+            const int comp[3] = {m, n, 0};
+            add_term(2, fld, comp);
+        }
+    }
+}
+
+void FusedPlaneAveraging::add(ThirdMomentAveraging& tm)
+{
+    auto& pa1 = tm.plane_average1();
+    auto& pa2 = tm.plane_average2();
+    auto& pa3 = tm.plane_average3();
+    const int f1 = field_index(pa1);
+    const int f2 = field_index(pa2);
+    const int f3 = field_index(pa3);
+    m_third.push_back(&tm);
+
+    for (int m = 0; m < pa1.ncomp(); ++m) {
+        for (int n = 0; n < pa2.ncomp(); ++n) {
+            for (int p = 0; p < pa3.ncomp(); ++p) {
+                // The pairwise products are required to convert the raw
+                // third moment into a central moment
+                const int fld12[3] = {f1, f2, 0};
+                const int comp12[3] = {m, n, 0};
+                add_term(2, fld12, comp12);
+                const int fld13[3] = {f1, f3, 0};
+                const int comp13[3] = {m, p, 0};
+                add_term(2, fld13, comp13);
+                const int fld23[3] = {f2, f3, 0};
+                const int comp23[3] = {n, p, 0};
+                add_term(2, fld23, comp23);
+
+                const int fld[3] = {f1, f2, f3};
+                const int comp[3] = {m, n, p};
+                add_term(3, fld, comp);
+            }
+        }
+    }
+}
+
+void FusedPlaneAveraging::sync_terms()
+{
+    if (!m_terms_dirty) {
+        return;
+    }
+
+    amrex::Vector<AvgTerm> terms(m_base_terms);
+    terms.insert(terms.end(), m_prod_terms.begin(), m_prod_terms.end());
+    m_d_terms.resize(terms.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, terms.begin(), terms.end(),
+        m_d_terms.begin());
+
+    m_shift_offset.resize(m_fields.size());
+    int offset = 0;
+    for (int f = 0; f < static_cast<int>(m_fields.size()); ++f) {
+        m_shift_offset[f] = offset;
+        offset += m_ncell_line * m_fields[f]->ncomp();
+    }
+    m_shift.resize(offset, 0.0);
+
+    m_terms_dirty = false;
+}
+
+void FusedPlaneAveraging::operator()(bool include_moments)
+{
+    BL_PROFILE("amr-wind::FusedPlaneAveraging::operator");
+
+    if (m_fields.empty()) {
+        return;
+    }
+
+    sync_terms();
+
+    const int nterms = include_moments
+                           ? num_terms()
+                           : static_cast<int>(m_base_terms.size());
+
+    // Shift the products by the previous averages to limit cancellation
+    if (include_moments) {
+        for (int f = 0; f < static_cast<int>(m_fields.size()); ++f) {
+            const auto& lavg = m_fields[f]->line_average();
+            std::copy(
+                lavg.begin(), lavg.end(),
+                m_shift.begin() + m_shift_offset[f]);
+        }
+    }
+
+    m_line.resize(static_cast<size_t>(m_ncell_line) * nterms);
+    std::fill(m_line.begin(), m_line.end(), 0.0);
+
+    switch (m_axis) {
+    case 0:
+        compute_terms(XDir(), nterms);
+        break;
+    case 1:
+        compute_terms(YDir(), nterms);
+        break;
+    case 2:
+        compute_terms(ZDir(), nterms);
+        break;
+    default:
+        amrex::Abort("axis must be equal to 0, 1, or 2");
+        break;
+    }
+
+    finalize(include_moments);
+}
+
+template <typename IndexSelector>
+void FusedPlaneAveraging::compute_terms(
+    const IndexSelector& idxOp, const int nterms)
+{
+    BL_PROFILE("amr-wind::FusedPlaneAveraging::compute_terms");
+
+    const amrex::Real denom = 1.0 / (amrex::Real)m_ncell_plane;
+
+    amrex::AsyncArray<amrex::Real> lavg(m_line.data(), m_line.size());
+    amrex::Real* line_avg = lavg.data();
+
+    amrex::AsyncArray<amrex::Real> lshift(m_shift.data(), m_shift.size());
+    const amrex::Real* shift = lshift.data();
+
+    const AvgTerm* terms = m_d_terms.data();
+    const int nfields = static_cast<int>(m_fields.size());
+
+    amrex::GpuArray<int, max_fields> ncomp{{0}};
+    amrex::GpuArray<int, max_fields> soff{{0}};
+    for (int f = 0; f < nfields; ++f) {
+        ncomp[f] = m_fields[f]->ncomp();
+        soff[f] = m_shift_offset[f];
+    }
+
+    const int level = m_fields[0]->level();
+    const auto& mfab0 = m_fields[0]->field()(level);
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(mfab0, amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+        amrex::Box bx = mfi.tilebox();
+
+        amrex::GpuArray<amrex::Array4<const amrex::Real>, max_fields> farr;
+        for (int f = 0; f < nfields; ++f) {
+            farr[f] = m_fields[f]->field()(level).const_array(mfi);
+        }
+
+        amrex::Box pbx =
+            PerpendicularBox<IndexSelector>(bx, amrex::IntVect{0, 0, 0});
+
+        amrex::ParallelFor(
+            amrex::Gpu::KernelInfo().setReduction(true), pbx,
+            [=] AMREX_GPU_DEVICE(
+                int p_i, int p_j, int p_k,
+                amrex::Gpu::Handler const& handler) noexcept {
+                // Loop over the direction perpendicular to the plane.
+                // This reduces the atomic pressure on the destination arrays.
+
+                amrex::Box lbx = ParallelBox<IndexSelector>(
+                    bx, amrex::IntVect{p_i, p_j, p_k});
+
+                for (int k = lbx.smallEnd(2); k <= lbx.bigEnd(2); ++k) {
+                    for (int j = lbx.smallEnd(1); j <= lbx.bigEnd(1); ++j) {
+                        for (int i = lbx.smallEnd(0); i <= lbx.bigEnd(0); ++i) {
+
+                            const int ind = idxOp(i, j, k);
+
+                            for (int t = 0; t < nterms; ++t) {
+                                const AvgTerm& term = terms[t];
+                                amrex::Real val = 1.0;
+                                if (term.nfac == 0) {
+                                    const auto& vel = farr[term.fld[0]];
+                                    const amrex::Real u1 =
+                                        vel(i, j, k, term.comp[0]);
+                                    const amrex::Real u2 =
+                                        vel(i, j, k, term.comp[1]);
+                                    val = std::sqrt(u1 * u1 + u2 * u2);
+                                } else if (term.nfac == 1) {
+                                    val = farr[term.fld[0]](
+                                        i, j, k, term.comp[0]);
+                                } else {
+                                    for (int q = 0; q < term.nfac; ++q) {
+                                        const int f = term.fld[q];
+                                        const int c = term.comp[q];
+                                        val *= farr[f](i, j, k, c) -
+                                               shift[soff[f] + ncomp[f] * ind +
+                                                     c];
+                                    }
+                                }
+
+                                amrex::Gpu::deviceReduceSum(
+                                    &line_avg[nterms * ind + t], val * denom,
+                                    handler);
+                            }
+                        }
+                    }
+                }
+            });
+    }
+
+    lavg.copyToHost(m_line.data(), m_line.size());
+    amrex::ParallelDescriptor::ReduceRealSum(
+        m_line.data(), static_cast<int>(m_line.size()));
+}
+
+void FusedPlaneAveraging::finalize(bool include_moments)
+{
+    BL_PROFILE("amr-wind::FusedPlaneAveraging::finalize");
+
+    const int nterms = include_moments ? num_terms()
+                                       : static_cast<int>(m_base_terms.size());
+    const int nline = m_ncell_line;
+
+    auto line_term = [&](const TermKey& key, int ind) {
+        return m_line[static_cast<size_t>(nterms) * ind + term_index(key)];
+    };
+    auto mean_key = [](int f, int c) { return TermKey{1, f, c, 0, 0, 0, 0}; };
+    auto prod_key = [](int fa, int ca, int fb, int cb) {
+        if (std::make_pair(fb, cb) < std::make_pair(fa, ca)) {
+            std::swap(fa, fb);
+            std::swap(ca, cb);
+        }
+        return TermKey{2, fa, ca, fb, cb, 0, 0};
+    };
+
+    // Means of the shifted fields, computed before the averages are updated
+    amrex::Vector<amrex::Real> smean;
+    if (include_moments) {
+        smean.resize(m_shift.size());
+        for (int f = 0; f < static_cast<int>(m_fields.size()); ++f) {
+            const int nc = m_fields[f]->ncomp();
+            for (int ind = 0; ind < nline; ++ind) {
+                for (int c = 0; c < nc; ++c) {
+                    const int idx = m_shift_offset[f] + nc * ind + c;
+                    smean[idx] = line_term(mean_key(f, c), ind) - m_shift[idx];
+                }
+            }
+        }
+    }
+    auto shifted_mean = [&](int f, int c, int ind) {
+        return smean[m_shift_offset[f] + m_fields[f]->ncomp() * ind + c];
+    };
+
+    amrex::Vector<amrex::Real> avg;
+    for (int f = 0; f < static_cast<int>(m_fields.size()); ++f) {
+        const int nc = m_fields[f]->ncomp();
+        avg.resize(static_cast<size_t>(nline) * nc);
+        for (int ind = 0; ind < nline; ++ind) {
+            for (int c = 0; c < nc; ++c) {
+                avg[nc * ind + c] = line_term(mean_key(f, c), ind);
+            }
+        }
+        m_fields[f]->set_line_average(avg);
+    }
+
+    for (auto* vpa : m_vel) {
+        const int f = field_index(*vpa);
+        const int h1 = (m_axis == 0) ? 1 : 0;
+        const int h2 = (m_axis == 2) ? 1 : 2;
+        const TermKey key{0, f, h1, f, h2, 0, 0};
+        avg.resize(nline);
+        for (int ind = 0; ind < nline; ++ind) {
+            avg[ind] = line_term(key, ind);
+        }
+        vpa->set_line_hvelmag_average(avg);
+    }
+
+    if (!include_moments) {
+        return;
+    }
+
+    for (auto* sm : m_second) {
+        const int f1 = field_index(sm->plane_average1());
+        const int f2 = field_index(sm->plane_average2());
+        const int nc1 = m_fields[f1]->ncomp();
+        const int nc2 = m_fields[f2]->ncomp();
+        const int nmom = nc1 * nc2;
+        avg.resize(static_cast<size_t>(nline) * nmom);
+        for (int ind = 0; ind < nline; ++ind) {
+            for (int m = 0; m < nc1; ++m) {
+                const amrex::Real a = shifted_mean(f1, m, ind);
+                for (int n = 0; n < nc2; ++n) {
+                    const amrex::Real b = shifted_mean(f2, n, ind);
+                    const amrex::Real ab =
+                        line_term(prod_key(f1, m, f2, n), ind);
+                    avg[nmom * ind + nc2 * m + n] = ab - a * b;
+                }
+            }
+        }
+        sm->set_line_moment(avg);
+    }
+
+    for (auto* tm : m_third) {
+        const int f1 = field_index(tm->plane_average1());
+        const int f2 = field_index(tm->plane_average2());
+        const int f3 = field_index(tm->plane_average3());
+        const int nc1 = m_fields[f1]->ncomp();
+        const int nc2 = m_fields[f2]->ncomp();
+        const int nc3 = m_fields[f3]->ncomp();
+        const int nmom = nc1 * nc2 * nc3;
+        avg.resize(static_cast<size_t>(nline) * nmom);
+        for (int ind = 0; ind < nline; ++ind) {
+            for (int m = 0; m < nc1; ++m) {
+                const amrex::Real a = shifted_mean(f1, m, ind);
+                for (int n = 0; n < nc2; ++n) {
+                    const amrex::Real b = shifted_mean(f2, n, ind);
+                    const amrex::Real ab =
+                        line_term(prod_key(f1, m, f2, n), ind);
+                    for (int p = 0; p < nc3; ++p) {
+                        const amrex::Real c = shifted_mean(f3, p, ind);
+                        const amrex::Real ac =
+                            line_term(prod_key(f1, m, f3, p), ind);
+                        const amrex::Real bc =
+                            line_term(prod_key(f2, n, f3, p), ind);
+
+                        // Canonical order of the triple product key
+                        std::array<std::pair<int, int>, 3> fac{
+                            {{f1, m}, {f2, n}, {f3, p}}};
+                        std::sort(fac.begin(), fac.end());
+                        const TermKey key{
+                            3,
+                            fac[0].first,
+                            fac[0].second,
+                            fac[1].first,
+                            fac[1].second,
+                            fac[2].first,
+                            fac[2].second};
+                        const amrex::Real abc = line_term(key, ind);
+
+                        avg[nmom * ind + nc2 * nc3 * m + nc3 * n + p] =
+                            abc - a * bc - b * ac - c * ab + 2.0 * a * b * c;
+                    }
+                }
+            }
+        }
+        tm->set_line_moment(avg);
+    }
+}
+
+} // namespace amr_wind
@@ -1,8 +1,12 @@
 #include <AMReX_MultiFab.H>
 #include <AMReX_REAL.H>
 #include <chrono>
+#include <condition_variable>
 #include <ctime>
 #include <fstream>
+#include <mutex>
+#include <sstream>
+#include <vector>
 
 #include "amr-wind/utilities/IOManager.H"
 #include "amr-wind/CFDSim.H"
@@ -11,7 +15,10 @@
 #include "amr-wind/utilities/DerivedQuantity.H"
 #include "amr-wind/utilities/DerivedQtyDefs.H"
 #include "amr-wind/utilities/ncutils/nc_interface.H"
+#include "amr-wind/utilities/PerfReport.H"
+#include "amr-wind/utilities/ShardedMultiFabIO.H"
 
+#include "AMReX_AsyncOut.H"
 #include "AMReX_ParmParse.H"
 #include "AMReX_PlotFileUtil.H"
 #include "AMReX_MultiFabUtil.H"
@@ -22,11 +29,54 @@
 
 namespace amr_wind {
 
+/** Memory staged for asynchronous output that has not been written yet
+ *
+ *  Shared between the main thread and the tasks executed on the AMReX
+ *  asynchronous output thread.
+ */
+struct AsyncOutputState
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    amrex::Long pending_bytes{0};
+    //! Number of output files whose completion task has not run yet
+    int pending_files{0};
+    //! Files the output thread failed to write
+    std::vector<std::string> failed_files;
+};
+
+namespace {
+
+//! Bytes owned by this rank for the MultiFab (including ghost cells)
+amrex::Long local_bytes(const amrex::MultiFab& mf)
+{
+    amrex::Long nbytes = 0;
+    for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+        nbytes += mf[mfi].nBytes();
+    }
+    return nbytes;
+}
+
+//! Bytes of valid cell data owned by this rank for the MultiFab
+amrex::Long local_valid_bytes(const amrex::MultiFab& mf)
+{
+    amrex::Long nbytes = 0;
+    for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+        nbytes += mfi.validbox().numPts() * mf.nComp() *
+                  static_cast<amrex::Long>(sizeof(amrex::Real));
+    }
+    return nbytes;
+}
+
+} // namespace
+
 IOManager::IOManager(CFDSim& sim)
-    : m_sim(sim), m_derived_mgr(new DerivedQtyMgr(m_sim.repo()))
+    : m_sim(sim)
+    , m_derived_mgr(new DerivedQtyMgr(m_sim.repo()))
+    , m_async_state(std::make_shared<AsyncOutputState>())
 {}
 
-IOManager::~IOManager() = default;
+IOManager::~IOManager() { wait_for_output(); }
 
 void IOManager::initialize_io()
 {
@@ -44,6 +94,22 @@ void IOManager::initialize_io()
     pp.query("check_file", m_chk_prefix);
     pp.query("restart_file", m_restart_file);
     pp.query("allow_missing_restart_fields", m_allow_missing_restart_fields);
+    pp.query("async_output", m_async_output);
+    pp.query("checkpoint_format", m_chk_format);
+    pp.query("checkpoint_nfiles", m_chk_nfiles);
+    pp.query("checkpoint_compression", m_chk_compression);
+    if ((m_chk_format != "native") && (m_chk_format != "sharded")) {
+        amrex::Abort(
+            "IOManager: Invalid io.checkpoint_format: " + m_chk_format);
+    }
+    AMREX_ALWAYS_ASSERT(m_chk_nfiles > 0);
+    {
+        amrex::Real max_pending_mb = 2048.0;
+        pp.query("async_max_pending_mb", max_pending_mb);
+        AMREX_ALWAYS_ASSERT(max_pending_mb > 0.0);
+        m_async_max_pending =
+            static_cast<amrex::Long>(max_pending_mb * 1024.0 * 1024.0);
+    }
 #ifdef AMR_WIND_USE_HDF5
     pp.query("output_hdf5_plotfile", m_output_hdf5_plotfile);
 #ifdef AMR_WIND_USE_HDF5_ZFP
@@ -84,6 +150,11 @@ void IOManager::initialize_io()
     }
 
     amrex::Print() << "Initializing I/O manager" << std::endl;
+    if (m_async_output && !amrex::AsyncOut::UseAsyncOut()) {
+        amrex::Print() << "  WARNING: io.async_output requires amrex.async_out "
+                          "= 1; writing output synchronously"
+                       << std::endl;
+    }
 
     // Process output variables information
     auto& repo = m_sim.repo();
@@ -127,34 +198,28 @@ void IOManager::initialize_io()
 void IOManager::write_plot_file()
 {
     BL_PROFILE("amr-wind::IOManager::write_plot_file");
+    perf::ScopedTimer perf_timer(perf::Region::io);
 
     amrex::Vector<int> istep(
         m_sim.mesh().finestLevel() + 1, m_sim.time().time_index());
     const int plt_comp = m_plt_num_comp;
     const int start_comp = m_plt_num_comp - m_derived_mgr->num_comp();
-    auto outfield = m_sim.repo().create_scratch_field(plt_comp);
     const int nlevels = m_sim.repo().num_active_levels();
 
-    for (int lev = 0; lev < nlevels; ++lev) {
-        int icomp = 0;
-        auto& mf = (*outfield)(lev);
-
-        for (auto* fld : m_plt_fields) {
-            amrex::MultiFab::Copy(
-                mf, (*fld)(lev), 0, icomp, fld->num_comp(), 0);
-            icomp += fld->num_comp();
-        }
-
-        for (auto* fld : m_int_plt_fields) {
-            amrex::MultiFab::Copy(
-                mf, amrex::ToMultiFab((*fld)(lev)), 0, icomp, fld->num_comp(),
-                0);
-            icomp += fld->num_comp();
-        }
+    // A single cell-centered output field is handed to the writer directly,
+    // otherwise the fields are gathered into a scratch field
+    std::unique_ptr<ScratchField> outfield;
+    amrex::Vector<const amrex::MultiFab*> plt_mf;
+    if ((m_plt_fields.size() == 1) && m_int_plt_fields.empty() &&
+        (m_derived_mgr->num_comp() == 0) &&
+        (m_plt_fields[0]->field_location() == FieldLoc::CELL)) {
+        plt_mf = m_plt_fields[0]->vec_const_ptrs();
+    } else {
+        outfield = m_sim.repo().create_scratch_field(plt_comp);
+        gather_plot_fields(*outfield, start_comp);
+        plt_mf = outfield->vec_const_ptrs();
     }
 
-    (*m_derived_mgr)(*outfield, start_comp);
-
     const std::string& plt_filename =
         amrex::Concatenate(m_plt_prefix, m_sim.time().time_index());
     const auto& mesh = m_sim.mesh();
@@ -163,8 +228,8 @@ void IOManager::write_plot_file()
 #ifdef AMR_WIND_USE_HDF5
     if (m_output_hdf5_plotfile) {
         amrex::WriteMultiLevelPlotfileHDF5SingleDset(
-            plt_filename, nlevels, outfield->vec_const_ptrs(), m_plt_var_names,
-            mesh.Geom(), m_sim.time().new_time(), istep, mesh.refRatio()
+            plt_filename, nlevels, plt_mf, m_plt_var_names, mesh.Geom(),
+            m_sim.time().new_time(), istep, mesh.refRatio()
 #ifdef AMR_WIND_USE_HDF5_ZFP
                                                              ,
             m_hdf5_compression
@@ -172,10 +237,22 @@ void IOManager::write_plot_file()
         );
     } else {
 #endif
+        // In asynchronous mode AMReX snapshots the valid cells and returns
+        // immediately, the output fields can be modified right after
+        amrex::Long nbytes = 0;
+        if (async_output()) {
+            for (int lev = 0; lev < nlevels; ++lev) {
+                nbytes += local_valid_bytes(*plt_mf[lev]);
+            }
+            reserve_async_output(nbytes);
+        }
         amrex::WriteMultiLevelPlotfile(
-            plt_filename, nlevels, outfield->vec_const_ptrs(), m_plt_var_names,
-            mesh.Geom(), m_sim.time().new_time(), istep, mesh.refRatio());
+            plt_filename, nlevels, plt_mf, m_plt_var_names, mesh.Geom(),
+            m_sim.time().new_time(), istep, mesh.refRatio());
         write_info_file(plt_filename);
+        if (async_output()) {
+            release_async_output(nbytes);
+        }
 #ifdef AMR_WIND_USE_HDF5
     }
 #endif
@@ -184,6 +261,7 @@ void IOManager::write_plot_file()
 void IOManager::write_checkpoint_file(const int start_level, int end_level)
 {
     BL_PROFILE("amr-wind::IOManager::write_checkpoint_file");
+    perf::ScopedTimer perf_timer(perf::Region::io);
     const std::string level_prefix = "Level_";
     const std::string chkname =
         amrex::Concatenate(m_chk_prefix, m_sim.time().time_index());
@@ -200,15 +278,134 @@ void IOManager::write_checkpoint_file(const int start_level, int end_level)
     write_header(chkname, start_level, end_level);
     write_info_file(chkname);
 
+    if (m_chk_format == "sharded") {
+        for (int lev = start_level; lev < end_level + 1; ++lev) {
+            for (auto* fld : m_chk_fields) {
+                auto& field = *fld;
+                ioutils::write_sharded(
+                    field(lev),
+                    amrex::MultiFabFileFullPrefix(
+                        lev - start_level, chkname, level_prefix,
+                        field.name()),
+                    m_chk_nfiles, m_chk_compression);
+            }
+        }
+        return;
+    }
+
+    if (!async_output()) {
+        for (int lev = start_level; lev < end_level + 1; ++lev) {
+            for (auto* fld : m_chk_fields) {
+                auto& field = *fld;
+                amrex::VisMF::Write(
+                    field(lev), amrex::MultiFabFileFullPrefix(
+                                    lev - start_level, chkname, level_prefix,
+                                    field.name()));
+            }
+        }
+        return;
+    }
+
+    // Each field is copied into a staging buffer (pinned host memory on GPUs)
+    // and written to disk by the AMReX output thread
+    amrex::Long nbytes = 0;
+    for (int lev = start_level; lev < end_level + 1; ++lev) {
+        for (auto* fld : m_chk_fields) {
+            nbytes += local_bytes((*fld)(lev));
+        }
+    }
+    reserve_async_output(nbytes);
     for (int lev = start_level; lev < end_level + 1; ++lev) {
         for (auto* fld : m_chk_fields) {
             auto& field = *fld;
-            amrex::VisMF::Write(
-                field(lev),
-                amrex::MultiFabFileFullPrefix(
-                    lev - start_level, chkname, level_prefix, field.name()));
+            amrex::VisMF::AsyncWrite(
+                field(lev), amrex::MultiFabFileFullPrefix(
+                                lev - start_level, chkname, level_prefix,
+                                field.name()));
         }
     }
+    release_async_output(nbytes);
+}
+
+void IOManager::gather_plot_fields(
+    ScratchField& outfield, const int start_comp)
+{
+    const int nlevels = m_sim.repo().num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        int icomp = 0;
+        auto& mf = outfield(lev);
+
+        for (auto* fld : m_plt_fields) {
+            amrex::MultiFab::Copy(
+                mf, (*fld)(lev), 0, icomp, fld->num_comp(), 0);
+            icomp += fld->num_comp();
+        }
+
+        for (auto* fld : m_int_plt_fields) {
+            amrex::MultiFab::Copy(
+                mf, amrex::ToMultiFab((*fld)(lev)), 0, icomp, fld->num_comp(),
+                0);
+            icomp += fld->num_comp();
+        }
+    }
+
+    (*m_derived_mgr)(outfield, start_comp);
+}
+
+bool IOManager::async_output() const
+{
+    return m_async_output && amrex::AsyncOut::UseAsyncOut();
+}
+
+void IOManager::reserve_async_output(const amrex::Long bytes)
+{
+    BL_PROFILE("amr-wind::IOManager::reserve_async_output");
+    auto& state = *m_async_state;
+    std::unique_lock<std::mutex> lock(state.mutex);
+    // A single write larger than the limit is allowed once nothing is pending
+    state.cv.wait(lock, [&] {
+        return (state.pending_bytes == 0) ||
+               (state.pending_bytes + bytes <= m_async_max_pending);
+    });
+    state.pending_bytes += bytes;
+    ++state.pending_files;
+}
+
+void IOManager::release_async_output(const amrex::Long bytes)
+{
+    // The output thread executes tasks in order, so this runs after all the
+    // writes submitted before it have completed. No MPI calls or profiling
+    // are allowed in the task.
+    auto state = m_async_state;
+    amrex::AsyncOut::Submit([state, bytes]() {
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->pending_bytes -= bytes;
+            --state->pending_files;
+        }
+        state->cv.notify_all();
+    });
+}
+
+amrex::Long IOManager::pending_output_bytes() const
+{
+    std::lock_guard<std::mutex> lock(m_async_state->mutex);
+    return m_async_state->pending_bytes;
+}
+
+void IOManager::wait_for_output()
+{
+    if (!m_async_state) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::IOManager::wait_for_output");
+    auto& state = *m_async_state;
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.cv.wait(lock, [&] { return state.pending_files == 0; });
+    if (!state.failed_files.empty()) {
+        amrex::FileOpenFailed(state.failed_files.front());
+    }
 }
 
 void IOManager::read_checkpoint_fields(
@@ -227,12 +424,37 @@ void IOManager::read_checkpoint_fields(
     // always use the level 0 domain
     amrex::Box orig_domain(ba_chk[0].minimalBox());
 
+    // Shifts of the stored data when replicating the domain
+    amrex::Vector<amrex::Vector<amrex::IntVect>> shifts(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (int k = 0; k < rep[2]; k++) {
+            for (int j = 0; j < rep[1]; j++) {
+                for (int i = 0; i < rep[0]; i++) {
+                    amrex::IntVect shift_vec(
+                        i * orig_domain.length(0), j * orig_domain.length(1),
+                        k * orig_domain.length(2));
+                    // equivalent to 2^lev
+                    shifts[lev].push_back(shift_vec * (1 << lev));
+                }
+            }
+        }
+    }
+
     for (int lev = 0; lev < nlevels; ++lev) {
         for (auto* fld : m_chk_fields) {
             auto& field = *fld;
             const auto& fab_file = amrex::MultiFabFileFullPrefix(
                 lev, restart_file, level_prefix, field.name());
 
+            // Sharded checkpoints are read directly into the current grids,
+            // every rank only reads the data overlapping its own boxes
+            if (ioutils::sharded_exists(fab_file)) {
+                ioutils::read_sharded(field(lev), fab_file, shifts[lev]);
+                field(lev).setBndry(0.0);
+                field(lev).FillBoundary(m_sim.mesh().Geom(lev).periodicity());
+                continue;
+            }
+
             // Fields might be registered for checkpoint but might not be
             // necessary for actually performing the simulation. Check if the
             // field exists before attempting to read the restart field.
@@ -256,23 +478,10 @@ void IOManager::read_checkpoint_fields(
                     tmp, amrex::MultiFabFileFullPrefix(
                              lev, restart_file, level_prefix, field.name()));
 
-                for (int k = 0; k < rep[2]; k++) {
-                    for (int j = 0; j < rep[1]; j++) {
-                        for (int i = 0; i < rep[0]; i++) {
-
-                            amrex::IntVect shift_vec(
-                                i * orig_domain.length(0),
-                                j * orig_domain.length(1),
-                                k * orig_domain.length(2));
-
-                            // equivalent to 2^lev
-                            shift_vec *= (1 << lev);
-
-                            tmp.shift(shift_vec);
-                            mfab.ParallelCopy(tmp);
-                            tmp.shift(-shift_vec);
-                        }
-                    }
+                for (const auto& shift_vec : shifts[lev]) {
+                    tmp.shift(shift_vec);
+                    mfab.ParallelCopy(tmp);
+                    tmp.shift(-shift_vec);
                 }
 
                 mfab.setBndry(0.0);
@@ -353,12 +562,11 @@ void IOManager::write_info_file(const std::string& path)
         return;
     }
 
+    // The contents are assembled on the calling thread, the banner queries
+    // MPI and the ParmParse table is not thread-safe
     const std::string dash_line = "\n" + std::string(78, '-') + "\n";
     const std::string fname(path + "/amr_wind_info");
-    std::ofstream fh(fname.c_str(), std::ios::out);
-    if (!fh.good()) {
-        amrex::FileOpenFailed(fname);
-    }
+    std::ostringstream fh;
 
     amr_wind::io::print_banner(amrex::ParallelContext::CommunicatorSub(), fh);
 
@@ -377,7 +585,36 @@ void IOManager::write_info_file(const std::string& path)
 
     fh << dash_line << "Input file parameters: " << std::endl;
     amrex::ParmParse::dumpTable(fh, true);
-    fh.close();
+
+    if (!async_output()) {
+        std::ofstream ofh(fname.c_str(), std::ios::out);
+        if (!ofh.good()) {
+            amrex::FileOpenFailed(fname);
+        }
+        ofh << fh.str();
+        return;
+    }
+
+    // Written by the output thread after the data files submitted before it,
+    // which also guarantees that the plot file directory exists
+    auto state = m_async_state;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        ++state->pending_files;
+    }
+    amrex::AsyncOut::Submit([state, fname, info = fh.str()]() {
+        std::ofstream ofh(fname.c_str(), std::ios::out);
+        ofh << info;
+        ofh.close();
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (!ofh) {
+                state->failed_files.push_back(fname);
+            }
+            --state->pending_files;
+        }
+        state->cv.notify_all();
+    });
 }
 
 } // namespace amr_wind
@@ -0,0 +1,270 @@
+#include "amr-wind/utilities/PerfReport.H"
+#include "amr-wind/core/SimTime.H"
+
+#include <array>
+#include <fstream>
+#include <iomanip>
+
+#include "AMReX_BLProfiler.H"
+#include "AMReX_Gpu.H"
+#include "AMReX_MLMG.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_ParmParse.H"
+#include "AMReX_Print.H"
+
+namespace amr_wind::perf {
+
+namespace {
+
+constexpr int num_regions = static_cast<int>(Region::num_regions);
+
+struct SolveInfo
+{
+    std::string name;
+    int iters;
+    amrex::Real init_residual;
+    amrex::Real final_residual;
+};
+
+//! Data collected during the current timestep
+struct ReportState
+{
+    bool enabled{false};
+    bool csv{false};
+    std::string filename;
+    std::ofstream os;
+
+    std::array<amrex::Real, num_regions> times{};
+    std::array<int, num_regions> calls{};
+    std::array<int, num_regions> depth{};
+    amrex::Vector<SolveInfo> solves;
+};
+
+ReportState& state()
+{
+    static ReportState s;
+    return s;
+}
+
+void write_json(
+    std::ostream& os,
+    const SimTime& time,
+    const amrex::Long num_cells,
+    const std::array<amrex::Real, 4>& steps,
+    const std::array<amrex::Real, num_regions>& tmax,
+    const std::array<amrex::Real, num_regions>& tavg,
+    const std::array<int, num_regions>& calls,
+    const amrex::Vector<SolveInfo>& solves)
+{
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    os << "{\"step\": " << time.time_index()
+       << ", \"time\": " << time.new_time() << ", \"dt\": " << time.deltaT()
+       << ", \"nprocs\": " << nprocs << ", \"num_cells\": " << num_cells
+       << ", \"pre\": " << steps[0] << ", \"solve\": " << steps[1]
+       << ", \"post\": " << steps[2] << ", \"total\": " << steps[3]
+       << ", \"cells_per_sec\": "
+       << ((steps[1] > 0.0) ? num_cells / steps[1] : 0.0)
+       << ", \"regions\": {";
+    for (int i = 0; i < num_regions; ++i) {
+        os << ((i > 0) ? ", " : "") << "\""
+           << region_name(static_cast<Region>(i)) << "\": {\"max\": "
+           << tmax[i] << ", \"avg\": " << tavg[i]
+           << ", \"calls\": " << calls[i] << "}";
+    }
+    os << "}, \"solves\": [";
+    for (int i = 0; i < solves.size(); ++i) {
+        const auto& sv = solves[i];
+        os << ((i > 0) ? ", " : "") << "{\"name\": \"" << sv.name
+           << "\", \"iters\": " << sv.iters
+           << ", \"initial_residual\": " << sv.init_residual
+           << ", \"final_residual\": " << sv.final_residual << "}";
+    }
+    os << "]}" << std::endl;
+}
+
+void write_csv(
+    std::ostream& os,
+    const SimTime& time,
+    const std::array<amrex::Real, 4>& steps,
+    const std::array<amrex::Real, num_regions>& tmax,
+    const std::array<amrex::Real, num_regions>& tavg,
+    const std::array<int, num_regions>& calls,
+    const amrex::Vector<SolveInfo>& solves)
+{
+    const int step = time.time_index();
+    const amrex::Real t = time.new_time();
+    const std::array<std::string, 4> step_names{
+        {"pre", "solve", "post", "total"}};
+    for (int i = 0; i < 4; ++i) {
+        os << step << "," << t << ",step," << step_names[i] << "," << steps[i]
+           << "," << steps[i] << ",1,," << std::endl;
+    }
+    for (int i = 0; i < num_regions; ++i) {
+        os << step << "," << t << ",region,"
+           << region_name(static_cast<Region>(i)) << "," << tmax[i] << ","
+           << tavg[i] << "," << calls[i] << ",," << std::endl;
+    }
+    for (const auto& sv : solves) {
+        os << step << "," << t << ",solve," << sv.name << ",,,1," << sv.iters
+           << "," << sv.final_residual << std::endl;
+    }
+}
+
+} // namespace
+
+std::string region_name(Region region)
+{
+    switch (region) {
+    case Region::regrid:
+        return "regrid";
+    case Region::advection:
+        return "advection";
+    case Region::diffusion:
+        return "diffusion";
+    case Region::source:
+        return "source";
+    case Region::projection:
+        return "projection";
+    case Region::fillpatch:
+        return "fillpatch";
+    case Region::turbulence:
+        return "turbulence";
+    case Region::actuator:
+        return "actuator";
+    case Region::sampling:
+        return "sampling";
+    case Region::io:
+        return "io";
+    default:
+        break;
+    }
+    amrex::Abort("perf::region_name: Invalid region");
+    return "";
+}
+
+void initialize()
+{
+    auto& s = state();
+    std::string format = "json";
+    amrex::ParmParse pp("io");
+    pp.query("perf_report", s.enabled);
+    pp.query("perf_report_format", format);
+    if (!s.enabled) {
+        return;
+    }
+
+    if ((format != "json") && (format != "csv")) {
+        amrex::Abort("Invalid io.perf_report_format: " + format);
+    }
+    s.csv = (format == "csv");
+    s.filename = s.csv ? "perf_report.csv" : "perf_report.jsonl";
+    pp.query("perf_report_file", s.filename);
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        s.os.open(s.filename, std::ios::out | std::ios::trunc);
+        if (!s.os.good()) {
+            amrex::FileOpenFailed(s.filename);
+        }
+        s.os << std::setprecision(6);
+        if (s.csv) {
+            s.os << "step,time,kind,name,max_time,avg_time,calls,iters,"
+                    "final_residual"
+                 << std::endl;
+        }
+    }
+    amrex::Print() << "Writing performance report to " << s.filename
+                   << std::endl;
+}
+
+bool enabled() { return state().enabled; }
+
+ScopedTimer::ScopedTimer(Region region) : m_region(region)
+{
+    auto& s = state();
+    if (!s.enabled) {
+        return;
+    }
+
+    const int idx = static_cast<int>(m_region);
+    m_active = (s.depth[idx]++ == 0);
+    if (m_active) {
+        // Kernels launched before the region are not attributed to it
+        amrex::Gpu::streamSynchronize();
+        m_start = amrex::ParallelDescriptor::second();
+    }
+}
+
+ScopedTimer::~ScopedTimer()
+{
+    auto& s = state();
+    if (!s.enabled) {
+        return;
+    }
+
+    const int idx = static_cast<int>(m_region);
+    --s.depth[idx];
+    if (m_active) {
+        amrex::Gpu::streamSynchronize();
+        s.times[idx] += amrex::ParallelDescriptor::second() - m_start;
+        ++s.calls[idx];
+    }
+}
+
+void record_solve(const std::string& name, const amrex::MLMG& mlmg)
+{
+    auto& s = state();
+    if (!s.enabled) {
+        return;
+    }
+    s.solves.push_back(
+        {name, mlmg.getNumIters(), mlmg.getInitResidual(),
+         mlmg.getFinalResidual()});
+}
+
+void begin_step()
+{
+    auto& s = state();
+    s.times.fill(0.0);
+    s.calls.fill(0);
+    s.solves.clear();
+}
+
+void end_step(
+    const SimTime& time,
+    const amrex::Long num_cells,
+    const amrex::Real pre,
+    const amrex::Real solve,
+    const amrex::Real post)
+{
+    auto& s = state();
+    if (!s.enabled) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::perf::end_step");
+    std::array<amrex::Real, 4> steps{{pre, solve, post, pre + solve + post}};
+    auto tmax = s.times;
+    auto tavg = s.times;
+    auto calls = s.calls;
+    amrex::ParallelDescriptor::ReduceRealMax(
+        steps.data(), static_cast<int>(steps.size()));
+    amrex::ParallelDescriptor::ReduceRealMax(tmax.data(), num_regions);
+    amrex::ParallelDescriptor::ReduceRealSum(tavg.data(), num_regions);
+    amrex::ParallelDescriptor::ReduceIntMax(calls.data(), num_regions);
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    for (auto& tt : tavg) {
+        tt /= nprocs;
+    }
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        if (s.csv) {
+            write_csv(s.os, time, steps, tmax, tavg, calls, s.solves);
+        } else {
+            write_json(
+                s.os, time, num_cells, steps, tmax, tavg, calls, s.solves);
+        }
+    }
+    begin_step();
+}
+
+} // namespace amr_wind::perf
@@ -89,6 +89,14 @@ SecondMomentAveraging::SecondMomentAveraging(
         0.0);
 }
 
+void SecondMomentAveraging::set_line_moment(
+    const amrex::Vector<amrex::Real>& moments)
+{
+    AMREX_ALWAYS_ASSERT(moments.size() == m_second_moments_line.size());
+    m_last_updated_index = m_plane_average1.last_updated_index();
+    std::copy(moments.begin(), moments.end(), m_second_moments_line.begin());
+}
+
 void SecondMomentAveraging::operator()()
 {
 
@@ -0,0 +1,321 @@
+#include "amr-wind/utilities/ShardedMultiFabIO.H"
+
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#include "AMReX_NFiles.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_Utility.H"
+
+namespace amr_wind::ioutils {
+
+namespace {
+
+const std::string manifest_version{"AMR-Wind-ShardedMultiFab-1.0"};
+
+std::string manifest_name(const std::string& prefix)
+{
+    return prefix + "_manifest";
+}
+
+std::string data_prefix(const std::string& prefix) { return prefix + "_D_"; }
+
+//! Location of a FAB within the data files
+struct FabLocation
+{
+    int file{0};
+    amrex::Long offset{0};
+    amrex::Long nbytes{0};
+};
+
+//! Contents of the manifest of a sharded MultiFab
+struct Manifest
+{
+    int ncomp{0};
+    bool compressed{false};
+    amrex::IndexType ixtype;
+    amrex::BoxArray ba;
+    amrex::Vector<FabLocation> fabs;
+};
+
+Manifest read_manifest(const std::string& prefix)
+{
+    amrex::Vector<char> buf;
+    amrex::ParallelDescriptor::ReadAndBcastFile(manifest_name(prefix), buf);
+    std::istringstream is(std::string(buf.dataPtr()), std::istringstream::in);
+
+    Manifest mfst;
+    std::string version;
+    int compressed = 0;
+    is >> version;
+    if (version != manifest_version) {
+        amrex::Abort(
+            "ShardedMultiFabIO: Invalid manifest " + manifest_name(prefix));
+    }
+    is >> mfst.ncomp >> compressed >> mfst.ixtype;
+    mfst.compressed = (compressed != 0);
+    mfst.ba.readFrom(is);
+
+    mfst.fabs.resize(mfst.ba.size());
+    for (auto& loc : mfst.fabs) {
+        is >> loc.file >> loc.offset >> loc.nbytes;
+    }
+    if (is.fail()) {
+        amrex::Abort(
+            "ShardedMultiFabIO: Error reading manifest " +
+            manifest_name(prefix));
+    }
+    return mfst;
+}
+
+} // namespace
+
+std::vector<char> compress(const amrex::Real* data, const amrex::Long num)
+{
+    constexpr int nb = sizeof(amrex::Real);
+    const auto* src = reinterpret_cast<const unsigned char*>(data);
+
+    // XOR with the previous value and regroup the bytes by significance
+    std::vector<unsigned char> planes(num * nb);
+    for (amrex::Long i = 0; i < num; ++i) {
+        for (int b = 0; b < nb; ++b) {
+            const unsigned char prev = (i > 0) ? src[(i - 1) * nb + b] : 0;
+            planes[b * num + i] = src[i * nb + b] ^ prev;
+        }
+    }
+
+    // Run-length encoding: a control byte c < 128 is followed by c + 1
+    // literal bytes, c >= 128 is followed by one byte repeated c - 125 times
+    std::vector<char> out;
+    out.reserve(planes.size() / 4 + 16);
+    const amrex::Long ntot = static_cast<amrex::Long>(planes.size());
+    amrex::Long pos = 0;
+    while (pos < ntot) {
+        amrex::Long run = 1;
+        while ((pos + run < ntot) && (run < 130) &&
+               (planes[pos + run] == planes[pos])) {
+            ++run;
+        }
+        if (run >= 3) {
+            out.push_back(static_cast<char>(run + 125));
+            out.push_back(static_cast<char>(planes[pos]));
+            pos += run;
+            continue;
+        }
+
+        // Literal bytes until the next run of at least three bytes
+        amrex::Long len = 0;
+        while ((pos + len < ntot) && (len < 128)) {
+            if ((pos + len + 2 < ntot) &&
+                (planes[pos + len] == planes[pos + len + 1]) &&
+                (planes[pos + len] == planes[pos + len + 2])) {
+                break;
+            }
+            ++len;
+        }
+        out.push_back(static_cast<char>(len - 1));
+        out.insert(out.end(), planes.begin() + pos, planes.begin() + pos + len);
+        pos += len;
+    }
+    return out;
+}
+
+void decompress(
+    const char* buf,
+    const amrex::Long nbytes,
+    amrex::Real* data,
+    const amrex::Long num)
+{
+    constexpr int nb = sizeof(amrex::Real);
+    const amrex::Long ntot = num * nb;
+    std::vector<unsigned char> planes(ntot);
+
+    amrex::Long ipos = 0;
+    amrex::Long opos = 0;
+    while ((ipos < nbytes) && (opos < ntot)) {
+        const int ctrl = static_cast<unsigned char>(buf[ipos++]);
+        if (ctrl < 128) {
+            const amrex::Long len = ctrl + 1;
+            AMREX_ALWAYS_ASSERT((ipos + len <= nbytes) && (opos + len <= ntot));
+            std::memcpy(&planes[opos], buf + ipos, len);
+            ipos += len;
+            opos += len;
+        } else {
+            const amrex::Long len = ctrl - 125;
+            AMREX_ALWAYS_ASSERT((ipos < nbytes) && (opos + len <= ntot));
+            std::memset(&planes[opos], buf[ipos++], len);
+            opos += len;
+        }
+    }
+    AMREX_ALWAYS_ASSERT((ipos == nbytes) && (opos == ntot));
+
+    auto* dst = reinterpret_cast<unsigned char*>(data);
+    for (amrex::Long i = 0; i < num; ++i) {
+        for (int b = 0; b < nb; ++b) {
+            const unsigned char prev = (i > 0) ? dst[(i - 1) * nb + b] : 0;
+            dst[i * nb + b] = planes[b * num + i] ^ prev;
+        }
+    }
+}
+
+void write_sharded(
+    const amrex::MultiFab& mf,
+    const std::string& prefix,
+    const int nfiles,
+    const bool compress_data)
+{
+    BL_PROFILE("amr-wind::ioutils::write_sharded");
+    const auto& ba = mf.boxArray();
+    const int nboxes = static_cast<int>(ba.size());
+    const int ncomp = mf.nComp();
+
+    // Copy the valid region of the local FABs to the host and encode them
+    // before any file is opened, so that the time spent holding a file is
+    // only spent writing
+    amrex::Vector<int> local_idx;
+    amrex::Vector<std::vector<char>> buffers;
+    for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+        const auto& bx = mfi.validbox();
+        amrex::FArrayBox hfab(bx, ncomp, amrex::The_Pinned_Arena());
+        hfab.copy<amrex::RunOn::Device>(mf[mfi], bx, 0, bx, 0, ncomp);
+        amrex::Gpu::streamSynchronize();
+
+        const amrex::Long num = hfab.size();
+        if (compress_data) {
+            buffers.push_back(compress(hfab.dataPtr(), num));
+        } else {
+            const auto* src = reinterpret_cast<const char*>(hfab.dataPtr());
+            buffers.emplace_back(src, src + hfab.nBytes());
+        }
+        local_idx.push_back(mfi.index());
+    }
+
+    amrex::Vector<int> file_num(nboxes, 0);
+    amrex::Vector<amrex::Long> offsets(nboxes, 0);
+    amrex::Vector<amrex::Long> sizes(nboxes, 0);
+    const int nout = amrex::NFilesIter::ActualNFiles(nfiles);
+    for (amrex::NFilesIter nfi(nout, data_prefix(prefix), false, true);
+         nfi.ReadyToWrite(); ++nfi) {
+        auto& os = nfi.Stream();
+        for (int i = 0; i < local_idx.size(); ++i) {
+            const int idx = local_idx[i];
+            const auto& buf = buffers[i];
+            file_num[idx] = nfi.FileNumber();
+            offsets[idx] = static_cast<amrex::Long>(os.tellp());
+            sizes[idx] = static_cast<amrex::Long>(buf.size());
+            os.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+        }
+        os.flush();
+        if (!os.good()) {
+            amrex::FileOpenFailed(nfi.FileName());
+        }
+    }
+
+    // Every box is owned by exactly one rank
+    const int ioproc = amrex::ParallelDescriptor::IOProcessorNumber();
+    amrex::ParallelDescriptor::ReduceIntSum(file_num.data(), nboxes, ioproc);
+    amrex::ParallelDescriptor::ReduceLongSum(offsets.data(), nboxes, ioproc);
+    amrex::ParallelDescriptor::ReduceLongSum(sizes.data(), nboxes, ioproc);
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::ofstream os(
+            manifest_name(prefix), std::ios::out | std::ios::trunc);
+        if (!os.good()) {
+            amrex::FileOpenFailed(manifest_name(prefix));
+        }
+        os << manifest_version << "\n"
+           << ncomp << " " << (compress_data ? 1 : 0) << " " << mf.ixType()
+           << "\n";
+        ba.writeOn(os);
+        os << "\n";
+        for (int i = 0; i < nboxes; ++i) {
+            os << file_num[i] << " " << offsets[i] << " " << sizes[i] << "\n";
+        }
+        os.flush();
+        if (!os.good()) {
+            amrex::Abort(
+                "ShardedMultiFabIO: Error writing " + manifest_name(prefix));
+        }
+    }
+}
+
+bool sharded_exists(const std::string& prefix)
+{
+    return amrex::FileExists(manifest_name(prefix));
+}
+
+void read_sharded(
+    amrex::MultiFab& mf,
+    const std::string& prefix,
+    const amrex::Vector<amrex::IntVect>& shifts)
+{
+    BL_PROFILE("amr-wind::ioutils::read_sharded");
+    const auto mfst = read_manifest(prefix);
+    const int ncomp = mf.nComp();
+    AMREX_ALWAYS_ASSERT(mfst.ncomp == ncomp);
+    AMREX_ALWAYS_ASSERT(mfst.ixtype == mf.ixType());
+
+    // Stored FABs required by the boxes owned by this rank
+    std::map<int, amrex::FArrayBox> src_fabs;
+    std::vector<std::pair<int, amrex::Box>> isects;
+    for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+        for (const auto& shift : shifts) {
+            mfst.ba.intersections(
+                amrex::shift(mfi.validbox(), -shift), isects);
+            for (const auto& is : isects) {
+                src_fabs[is.first];
+            }
+        }
+    }
+
+    std::string fname;
+    std::ifstream ifs;
+    std::vector<char> buf;
+    for (auto& [idx, hfab] : src_fabs) {
+        const auto& loc = mfst.fabs[idx];
+        const auto& bx = mfst.ba[idx];
+        const auto name =
+            amrex::NFilesIter::FileName(loc.file, data_prefix(prefix));
+        if (name != fname) {
+            ifs.close();
+            ifs.open(name, std::ios::in | std::ios::binary);
+            if (!ifs.good()) {
+                amrex::FileOpenFailed(name);
+            }
+            fname = name;
+        }
+
+        hfab.resize(bx, ncomp, amrex::The_Pinned_Arena());
+        buf.resize(loc.nbytes);
+        ifs.seekg(loc.offset, std::ios::beg);
+        ifs.read(buf.data(), static_cast<std::streamsize>(loc.nbytes));
+        if (!ifs.good()) {
+            amrex::Abort("ShardedMultiFabIO: Error reading " + name);
+        }
+        if (mfst.compressed) {
+            decompress(buf.data(), loc.nbytes, hfab.dataPtr(), hfab.size());
+        } else {
+            AMREX_ALWAYS_ASSERT(loc.nbytes == hfab.nBytes());
+            std::memcpy(hfab.dataPtr(), buf.data(), loc.nbytes);
+        }
+    }
+
+    for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+        auto& dfab = mf[mfi];
+        for (const auto& shift : shifts) {
+            mfst.ba.intersections(
+                amrex::shift(mfi.validbox(), -shift), isects);
+            for (const auto& is : isects) {
+                const auto& sfab = src_fabs.at(is.first);
+                dfab.copy<amrex::RunOn::Device>(
+                    sfab, is.second, 0, amrex::shift(is.second, shift), 0,
+                    ncomp);
+            }
+        }
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
+} // namespace amr_wind::ioutils
@@ -105,6 +105,14 @@ ThirdMomentAveraging::ThirdMomentAveraging(
         0.0);
 }
 
+void ThirdMomentAveraging::set_line_moment(
+    const amrex::Vector<amrex::Real>& moments)
+{
+    AMREX_ALWAYS_ASSERT(moments.size() == m_third_moments_line.size());
+    m_last_updated_index = m_plane_average1.last_updated_index();
+    std::copy(moments.begin(), moments.end(), m_third_moments_line.begin());
+}
+
 void ThirdMomentAveraging::operator()()
 {
 
@@ -0,0 +1,419 @@
+#include "amr-wind/utilities/TriangleMesh.H"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+
+#include "AMReX.H"
+#include "AMReX_ParallelDescriptor.H"
+
+namespace amr_wind::utils {
+
+namespace {
+
+//! Closest point to `pt` on the triangle (Ericson, Real-Time Collision
+//! Detection, Section 5.1.5)
+vs::Vector
+closest_point(const vs::Vector& pt, const TriangleMesh::Triangle& tri)
+{
+    const auto& a = tri[0];
+    const auto& b = tri[1];
+    const auto& c = tri[2];
+    const vs::Vector ab = b - a;
+    const vs::Vector ac = c - a;
+
+    // Vertex regions
+    const vs::Vector ap = pt - a;
+    const amrex::Real d1 = ab & ap;
+    const amrex::Real d2 = ac & ap;
+    if ((d1 <= 0.0) && (d2 <= 0.0)) {
+        return a;
+    }
+    const vs::Vector bp = pt - b;
+    const amrex::Real d3 = ab & bp;
+    const amrex::Real d4 = ac & bp;
+    if ((d3 >= 0.0) && (d4 <= d3)) {
+        return b;
+    }
+    const vs::Vector cp = pt - c;
+    const amrex::Real d5 = ab & cp;
+    const amrex::Real d6 = ac & cp;
+    if ((d6 >= 0.0) && (d5 <= d6)) {
+        return c;
+    }
+
+    // Edge regions
+    const amrex::Real vc = d1 * d4 - d3 * d2;
+    if ((vc <= 0.0) && (d1 >= 0.0) && (d3 <= 0.0)) {
+        return a + ab * (d1 / (d1 - d3));
+    }
+    const amrex::Real vb = d5 * d2 - d1 * d6;
+    if ((vb <= 0.0) && (d2 >= 0.0) && (d6 <= 0.0)) {
+        return a + ac * (d2 / (d2 - d6));
+    }
+    const amrex::Real va = d3 * d6 - d5 * d4;
+    if ((va <= 0.0) && ((d4 - d3) >= 0.0) && ((d5 - d6) >= 0.0)) {
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+
+    // Face region
+    const amrex::Real denom = 1.0 / (va + vb + vc);
+    return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+/** Side of the edge `(a, b)` on which the point `(y, z)` lies in the y-z plane
+ *
+ *  Returns the value of the edge function in `w` and its sign, where points
+ *  on the edge are moved off it by the symbolic perturbation
+ *  \f$(y + \delta, z + \delta^2)\f$. The edge function is always evaluated
+ *  with the end points in the same order, so that triangles sharing an edge
+ *  see the exact opposite value and a line through the edge crosses exactly
+ *  one of them.
+ */
+int edge_side(
+    const vs::Vector& a,
+    const vs::Vector& b,
+    const amrex::Real y,
+    const amrex::Real z,
+    amrex::Real& w)
+{
+    const bool swap = (b.y() < a.y()) || ((b.y() == a.y()) && (b.z() < a.z()));
+    const auto& p = swap ? b : a;
+    const auto& q = swap ? a : b;
+    const amrex::Real dy = q.y() - p.y();
+    const amrex::Real dz = q.z() - p.z();
+    w = dy * (z - p.z()) - dz * (y - p.y());
+
+    int side = 0;
+    if (w != 0.0) {
+        side = (w > 0.0) ? 1 : -1;
+    } else if (dz != 0.0) {
+        side = (dz > 0.0) ? -1 : 1;
+    } else if (dy != 0.0) {
+        side = (dy > 0.0) ? 1 : -1;
+    }
+    if (swap) {
+        w = -w;
+        side = -side;
+    }
+    return side;
+}
+
+//! Smallest box containing the triangle
+amrex::RealBox bounding_box(const TriangleMesh::Triangle& tri)
+{
+    amrex::RealBox bx;
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        bx.setLo(d, amrex::min(tri[0][d], amrex::min(tri[1][d], tri[2][d])));
+        bx.setHi(d, amrex::max(tri[0][d], amrex::max(tri[1][d], tri[2][d])));
+    }
+    return bx;
+}
+
+} // namespace
+
+void TriangleMesh::read(const std::string& fname)
+{
+    const auto pos = fname.rfind('.');
+    std::string ext = (pos == std::string::npos) ? "" : fname.substr(pos + 1);
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) {
+        return std::tolower(c);
+    });
+
+    if (ext == "stl") {
+        read_stl(fname);
+    } else if (ext == "obj") {
+        read_obj(fname);
+    } else {
+        amrex::Abort("TriangleMesh: Unknown surface file format: " + fname);
+    }
+}
+
+void TriangleMesh::read_stl(const std::string& fname)
+{
+    BL_PROFILE("amr-wind::TriangleMesh::read_stl");
+    amrex::Vector<char> buf;
+    amrex::ParallelDescriptor::ReadAndBcastFile(fname, buf);
+    // The buffer is null terminated
+    const amrex::Long nbytes = static_cast<amrex::Long>(buf.size()) - 1;
+
+    // Binary files have an 80 byte header, the number of triangles, and 50
+    // bytes per triangle. ASCII files may also start with "solid", so the
+    // size is used to detect the format.
+    std::uint32_t ntri = 0;
+    if (nbytes >= 84) {
+        std::memcpy(&ntri, buf.dataPtr() + 80, sizeof(ntri));
+    }
+    amrex::Vector<Triangle> tris;
+    if ((nbytes >= 84) &&
+        (nbytes == 84 + 50 * static_cast<amrex::Long>(ntri))) {
+        tris.resize(ntri);
+        for (std::uint32_t n = 0; n < ntri; ++n) {
+            // Skip the facet normal
+            float xyz[9];
+            std::memcpy(xyz, buf.dataPtr() + 84 + 50 * n + 12, sizeof(xyz));
+            for (int iv = 0; iv < 3; ++iv) {
+                tris[n][iv] =
+                    vs::Vector(xyz[3 * iv], xyz[3 * iv + 1], xyz[3 * iv + 2]);
+            }
+        }
+    } else {
+        std::istringstream is(std::string(buf.dataPtr()));
+        std::string token;
+        Triangle tri;
+        int iv = 0;
+        while (is >> token) {
+            if (token != "vertex") {
+                continue;
+            }
+            amrex::Real x;
+            amrex::Real y;
+            amrex::Real z;
+            is >> x >> y >> z;
+            if (is.fail()) {
+                amrex::Abort("TriangleMesh: Invalid vertex in " + fname);
+            }
+            tri[iv] = vs::Vector(x, y, z);
+            if (++iv == 3) {
+                tris.push_back(tri);
+                iv = 0;
+            }
+        }
+        if (iv != 0) {
+            amrex::Abort("TriangleMesh: Incomplete triangle in " + fname);
+        }
+    }
+    define(std::move(tris));
+}
+
+void TriangleMesh::read_obj(const std::string& fname)
+{
+    BL_PROFILE("amr-wind::TriangleMesh::read_obj");
+    amrex::Vector<char> buf;
+    amrex::ParallelDescriptor::ReadAndBcastFile(fname, buf);
+    std::istringstream is(std::string(buf.dataPtr()));
+
+    amrex::Vector<vs::Vector> verts;
+    amrex::Vector<Triangle> tris;
+    amrex::Vector<int> face;
+    std::string line;
+    while (std::getline(is, line)) {
+        std::istringstream ls(line);
+        std::string key;
+        ls >> key;
+        if (key == "v") {
+            amrex::Real x;
+            amrex::Real y;
+            amrex::Real z;
+            ls >> x >> y >> z;
+            if (ls.fail()) {
+                amrex::Abort("TriangleMesh: Invalid vertex in " + fname);
+            }
+            verts.emplace_back(x, y, z);
+        } else if (key == "f") {
+            // Vertex indices start at one and negative indices are relative
+            // to the end of the current list. Texture and normal indices
+            // following a slash are ignored.
+            face.clear();
+            std::string entry;
+            while (ls >> entry) {
+                const int idx = std::stoi(entry.substr(0, entry.find('/')));
+                const int nv = static_cast<int>(verts.size());
+                const int iv = (idx < 0) ? nv + idx : idx - 1;
+                if ((iv < 0) || (iv >= nv)) {
+                    amrex::Abort("TriangleMesh: Invalid face in " + fname);
+                }
+                face.push_back(iv);
+            }
+            // Triangulate polygons as a fan around the first vertex
+            for (int n = 1; n + 1 < face.size(); ++n) {
+                tris.push_back(
+                    {verts[face[0]], verts[face[n]], verts[face[n + 1]]});
+            }
+        }
+    }
+    define(std::move(tris));
+}
+
+void TriangleMesh::define(amrex::Vector<Triangle> triangles)
+{
+    m_tris = std::move(triangles);
+    build_tree();
+}
+
+void TriangleMesh::transform(const amrex::Real scale, const vs::Vector& offset)
+{
+    for (auto& tri : m_tris) {
+        for (auto& vtx : tri) {
+            vtx = vtx * scale + offset;
+        }
+    }
+    build_tree();
+}
+
+void TriangleMesh::build_tree()
+{
+    BL_PROFILE("amr-wind::TriangleMesh::build_tree");
+    amrex::Vector<amrex::RealBox> boxes(m_tris.size());
+    m_bbox = amrex::RealBox();
+    for (int n = 0; n < num_triangles(); ++n) {
+        boxes[n] = bounding_box(m_tris[n]);
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            const amrex::Real lo = boxes[n].lo(d);
+            const amrex::Real hi = boxes[n].hi(d);
+            m_bbox.setLo(d, (n == 0) ? lo : amrex::min(m_bbox.lo(d), lo));
+            m_bbox.setHi(d, (n == 0) ? hi : amrex::max(m_bbox.hi(d), hi));
+        }
+    }
+    m_tree.build(boxes);
+}
+
+amrex::Real
+TriangleMesh::distance(const vs::Vector& pt, const amrex::Real max_dist) const
+{
+    amrex::Vector<int> indices;
+    return distance(pt, max_dist, indices);
+}
+
+amrex::Real TriangleMesh::distance(
+    const vs::Vector& pt,
+    const amrex::Real max_dist,
+    amrex::Vector<int>& indices) const
+{
+    const amrex::RealBox bx(
+        pt.x() - max_dist, pt.y() - max_dist, pt.z() - max_dist,
+        pt.x() + max_dist, pt.y() + max_dist, pt.z() + max_dist);
+    m_tree.query(bx, indices);
+
+    amrex::Real dist2 = max_dist * max_dist;
+    for (const int n : indices) {
+        const vs::Vector dvec = pt - closest_point(pt, m_tris[n]);
+        dist2 = amrex::min(dist2, vs::mag_sqr(dvec));
+    }
+    return std::sqrt(dist2);
+}
+
+void TriangleMesh::crossings(
+    const amrex::Real y,
+    const amrex::Real z,
+    amrex::Vector<amrex::Real>& xc) const
+{
+    xc.clear();
+    amrex::Vector<int> indices;
+    const amrex::RealBox line(m_bbox.lo(0), y, z, m_bbox.hi(0), y, z);
+    m_tree.query(line, indices);
+
+    for (const int n : indices) {
+        const auto& tri = m_tris[n];
+        amrex::Real w0;
+        amrex::Real w1;
+        amrex::Real w2;
+        const int s0 = edge_side(tri[1], tri[2], y, z, w0);
+        const int s1 = edge_side(tri[2], tri[0], y, z, w1);
+        const int s2 = edge_side(tri[0], tri[1], y, z, w2);
+        const amrex::Real wsum = w0 + w1 + w2;
+        if ((s0 == 0) || (s0 != s1) || (s0 != s2) || (wsum == 0.0)) {
+            continue;
+        }
+        xc.push_back(
+            (w0 * tri[0].x() + w1 * tri[1].x() + w2 * tri[2].x()) / wsum);
+    }
+    std::sort(xc.begin(), xc.end());
+}
+
+bool TriangleMesh::contains(const vs::Vector& pt) const
+{
+    if (!m_bbox.contains(pt.data())) {
+        return false;
+    }
+    amrex::Vector<amrex::Real> xc;
+    crossings(pt.y(), pt.z(), xc);
+    const auto nc = std::count_if(
+        xc.begin(), xc.end(), [&](const amrex::Real x) { return x > pt.x(); });
+    return (nc % 2) != 0;
+}
+
+template <typename F>
+void TriangleMesh::for_each_point(
+    const amrex::Box& bx,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& problo,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dx,
+    F&& func) const
+{
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> offset;
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        offset[d] = bx.ixType().cellCentered(d) ? 0.5 : 0.0;
+    }
+
+    const auto lo = amrex::lbound(bx);
+    const auto hi = amrex::ubound(bx);
+    amrex::Vector<amrex::Real> xc;
+    for (int k = lo.z; k <= hi.z; ++k) {
+        const amrex::Real z = problo[2] + (k + offset[2]) * dx[2];
+        for (int j = lo.y; j <= hi.y; ++j) {
+            const amrex::Real y = problo[1] + (j + offset[1]) * dx[1];
+            // Points are inside if the line crosses the surface an odd
+            // number of times beyond them
+            xc.clear();
+            if ((y >= m_bbox.lo(1)) && (y <= m_bbox.hi(1)) &&
+                (z >= m_bbox.lo(2)) && (z <= m_bbox.hi(2))) {
+                crossings(y, z, xc);
+            }
+            int ic = 0;
+            const int nc = static_cast<int>(xc.size());
+            for (int i = lo.x; i <= hi.x; ++i) {
+                const vs::Vector pt(
+                    problo[0] + (i + offset[0]) * dx[0], y, z);
+                while ((ic < nc) && (xc[ic] <= pt.x())) {
+                    ++ic;
+                }
+                func(i, j, k, pt, ((nc - ic) % 2) != 0);
+            }
+        }
+    }
+}
+
+void TriangleMesh::signed_distance(
+    const amrex::Box& bx,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& problo,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dx,
+    const amrex::Real band,
+    const amrex::Array4<amrex::Real>& phi) const
+{
+    BL_PROFILE("amr-wind::TriangleMesh::signed_distance");
+    amrex::RealBox band_box = m_bbox;
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        band_box.setLo(d, m_bbox.lo(d) - band);
+        band_box.setHi(d, m_bbox.hi(d) + band);
+    }
+
+    amrex::Vector<int> indices;
+    for_each_point(
+        bx, problo, dx,
+        [&](const int i, const int j, const int k, const vs::Vector& pt,
+            const bool inside) {
+            amrex::Real dist = band;
+            if (band_box.contains(pt.data())) {
+                dist = distance(pt, band, indices);
+            }
+            phi(i, j, k) = inside ? -dist : dist;
+        });
+}
+
+void TriangleMesh::contains(
+    const amrex::Box& bx,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& problo,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dx,
+    const amrex::Array4<int>& inside) const
+{
+    BL_PROFILE("amr-wind::TriangleMesh::contains");
+    for_each_point(
+        bx, problo, dx,
+        [&](const int i, const int j, const int k, const vs::Vector& /*pt*/,
+            const bool is_inside) { inside(i, j, k) = is_inside ? 1 : 0; });
+}
+
+} // namespace amr_wind::utils
@@ -4,6 +4,7 @@
 #include "amr-wind/utilities/io_utils.H"
 
 #include "AMReX_ParmParse.H"
+#include "AMReX_MultiFabUtil.H"
 #include "AMReX_Conduit_Blueprint.H"
 
 #include <ascent.hpp>
@@ -11,11 +12,51 @@
 namespace amr_wind {
 namespace ascent_int {
 
+namespace {
+
+//! Component names of a list of fields
+amrex::Vector<std::string> var_names(const amrex::Vector<Field*>& fields)
+{
+    amrex::Vector<std::string> names;
+    for (const auto* fld : fields) {
+        ioutils::add_var_names(names, fld->name(), fld->num_comp());
+    }
+    return names;
+}
+
+/** Add the components of a fab as fields of a blueprint patch
+ *
+ *  The field values reference the fab data and are not copied.
+ */
+void add_external_fields(
+    const amrex::FArrayBox& fab,
+    const amrex::Vector<std::string>& names,
+    conduit::Node& patch)
+{
+    const std::string topo_name = patch["topologies"].child(0).name();
+    auto& n_fields = patch["fields"];
+    const amrex::Long npts = fab.box().numPts();
+    for (int i = 0; i < names.size(); ++i) {
+        auto& n_field = n_fields[names[i]];
+        n_field["association"] = "element";
+        n_field["topology"] = topo_name;
+        n_field["values"].set_external(
+            const_cast<amrex::Real*>(fab.dataPtr(i)), npts);
+    }
+}
+
+} // namespace
+
 AscentPostProcess::AscentPostProcess(CFDSim& sim, const std::string& label)
     : m_sim(sim), m_label(label)
 {}
 
-AscentPostProcess::~AscentPostProcess() = default;
+AscentPostProcess::~AscentPostProcess()
+{
+    if (m_ascent) {
+        m_ascent->close();
+    }
+}
 
 void AscentPostProcess::pre_init_actions() {}
 
@@ -42,77 +83,165 @@ void AscentPostProcess::initialize()
         }
 
         auto& fld = repo.get_field(fname);
+        if ((fld.field_location() != FieldLoc::CELL) &&
+            (fld.field_location() != FieldLoc::NODE)) {
+            amrex::Print() << "WARNING: Ascent: Face-centered field requested: "
+                           << fname << std::endl;
+            continue;
+        }
         m_fields.emplace_back(&fld);
-        ioutils::add_var_names(m_var_names, fld.name(), fld.num_comp());
     }
+
+    m_ascent = std::make_unique<ascent::Ascent>();
+    conduit::Node open_opts;
+
+#ifdef AMREX_USE_MPI
+    open_opts["mpi_comm"] =
+        MPI_Comm_c2f(amrex::ParallelDescriptor::Communicator());
+#endif
+    m_ascent->open(open_opts);
 }
 
-void AscentPostProcess::post_advance_work()
+void AscentPostProcess::build_blueprint()
 {
-    BL_PROFILE("amr-wind::AscentPostProcess::post_advance_work");
-
-    const auto& time = m_sim.time();
-    const int tidx = time.time_index();
-    // Output only on given frequency
-    if (!(tidx % m_out_freq == 0)) return;
+    BL_PROFILE("amr-wind::AscentPostProcess::build_blueprint");
 
-    amrex::Vector<int> istep(
-        m_sim.mesh().finestLevel() + 1, m_sim.time().time_index());
+    const auto& mesh = m_sim.mesh();
+    const int nlevels = m_sim.repo().num_active_levels();
 
-    int plt_num_comp = 0;
+    // Cell-centered fields with the same ghost cells as the first one share
+    // its topology and are published directly
+    m_direct_fields.clear();
+    m_copied_fields.clear();
     for (auto* fld : m_fields) {
-        plt_num_comp += fld->num_comp();
+        if ((fld->field_location() == FieldLoc::CELL) &&
+            (m_direct_fields.empty() ||
+             (fld->num_grow() == m_direct_fields[0]->num_grow()))) {
+            m_direct_fields.push_back(fld);
+        } else {
+            m_copied_fields.push_back(fld);
+        }
     }
 
-    auto outfield = m_sim.repo().create_scratch_field(plt_num_comp);
+    const amrex::IntVect ngrow = m_direct_fields.empty()
+                                     ? amrex::IntVect(0)
+                                     : m_direct_fields[0]->num_grow();
+    int buf_comp = 0;
+    for (const auto* fld : m_copied_fields) {
+        buf_comp += fld->num_comp();
+    }
+    m_buffer.clear();
+    if (buf_comp > 0) {
+        m_buffer.resize(nlevels);
+        for (int lev = 0; lev < nlevels; ++lev) {
+            m_buffer[lev].define(
+                mesh.boxArray(lev), mesh.DistributionMap(lev), buf_comp,
+                ngrow);
+            m_buffer[lev].setVal(0.0);
+        }
+    }
 
-    const int nlevels = m_sim.repo().num_active_levels();
+    // The first published field defines the topology of the patches
+    amrex::Vector<const amrex::MultiFab*> ref_mfs;
+    amrex::Vector<std::string> ref_names;
+    if (!m_direct_fields.empty()) {
+        ref_mfs = m_direct_fields[0]->vec_const_ptrs();
+        ref_names = var_names({m_direct_fields[0]});
+    } else {
+        ref_mfs = amrex::GetVecOfConstPtrs(m_buffer);
+        ref_names = var_names(m_copied_fields);
+    }
 
+    amrex::Vector<int> istep(nlevels, m_sim.time().time_index());
+    m_bp_mesh = std::make_unique<conduit::Node>();
+    amrex::MultiLevelToBlueprint(
+        nlevels, ref_mfs, ref_names, mesh.Geom(), m_sim.time().new_time(),
+        istep, mesh.refRatio(), *m_bp_mesh);
+
+    // Patches are created in the order of the levels and MFIter
+    const bool has_direct = !m_direct_fields.empty();
+    const bool add_buffer = has_direct && (buf_comp > 0);
+    const auto buf_names = var_names(m_copied_fields);
+    amrex::Vector<amrex::Vector<std::string>> direct_names;
+    for (auto* fld : m_direct_fields) {
+        direct_names.push_back(var_names({fld}));
+    }
+    conduit::index_t ipatch = 0;
     for (int lev = 0; lev < nlevels; ++lev) {
-        int icomp = 0;
-        auto& mf = (*outfield)(lev);
+        for (amrex::MFIter mfi(*ref_mfs[lev]); mfi.isValid(); ++mfi) {
+            auto& patch = m_bp_mesh->child(ipatch++);
+            for (int i = 1; i < m_direct_fields.size(); ++i) {
+                add_external_fields(
+                    (*m_direct_fields[i])(lev)[mfi], direct_names[i], patch);
+            }
+            if (add_buffer) {
+                add_external_fields(m_buffer[lev][mfi], buf_names, patch);
+            }
+        }
+    }
 
-        for (auto* fld : m_fields) {
-            amrex::MultiFab::Copy(
-                mf, (*fld)(lev), 0, icomp, fld->num_comp(), 0);
+    conduit::Node verify_info;
+    if (!conduit::blueprint::mesh::verify(*m_bp_mesh, verify_info)) {
+        ASCENT_INFO("Error: Mesh Blueprint Verify Failed!");
+        verify_info.print();
+    }
+}
+
+void AscentPostProcess::fill_buffer()
+{
+    BL_PROFILE("amr-wind::AscentPostProcess::fill_buffer");
+
+    for (int lev = 0; lev < m_buffer.size(); ++lev) {
+        int icomp = 0;
+        auto& mf = m_buffer[lev];
+
+        for (auto* fld : m_copied_fields) {
+            if (fld->field_location() == FieldLoc::NODE) {
+                amrex::average_node_to_cellcenter(
+                    mf, icomp, (*fld)(lev), 0, fld->num_comp());
+            } else {
+                amrex::MultiFab::Copy(
+                    mf, (*fld)(lev), 0, icomp, fld->num_comp(), 0);
+            }
             icomp += fld->num_comp();
         }
     }
+}
 
-    const auto& mesh = m_sim.mesh();
+void AscentPostProcess::post_advance_work()
+{
+    BL_PROFILE("amr-wind::AscentPostProcess::post_advance_work");
 
-    amrex::Print() << "Calling Ascent at time " << m_sim.time().new_time()
-                   << std::endl;
-    conduit::Node bp_mesh;
-    amrex::MultiLevelToBlueprint(
-        nlevels, outfield->vec_const_ptrs(), m_var_names, mesh.Geom(),
-        m_sim.time().new_time(), istep, mesh.refRatio(), bp_mesh);
+    const auto& time = m_sim.time();
+    const int tidx = time.time_index();
+    // Output only on given frequency
+    if (!(tidx % m_out_freq == 0)) return;
+    if (m_fields.empty()) return;
 
-    ascent::Ascent ascent;
-    conduit::Node open_opts;
+    if (m_mesh_changed) {
+        build_blueprint();
+        m_mesh_changed = false;
+    }
+    fill_buffer();
 
-#ifdef AMREX_USE_MPI
-    open_opts["mpi_comm"] =
-        MPI_Comm_c2f(amrex::ParallelDescriptor::Communicator());
-#endif
-    ascent.open(open_opts);
-    conduit::Node verify_info;
-    if (!conduit::blueprint::mesh::verify(bp_mesh, verify_info)) {
-        ASCENT_INFO("Error: Mesh Blueprint Verify Failed!");
-        verify_info.print();
+    amrex::Print() << "Calling Ascent at time " << time.new_time()
+                   << std::endl;
+    for (conduit::index_t i = 0; i < m_bp_mesh->number_of_children(); ++i) {
+        auto& patch = m_bp_mesh->child(i);
+        patch["state/time"] = time.new_time();
+        patch["state/cycle"] = tidx;
     }
 
     conduit::Node actions;
-    ascent.publish(bp_mesh);
-
-    ascent.execute(actions);
+    m_ascent->publish(*m_bp_mesh);
 
-    ascent.close();
+    m_ascent->execute(actions);
 }
 
 void AscentPostProcess::post_regrid_actions()
 {
-    // nothing to do here
+    // Field data was reallocated, the blueprint is rebuilt at the next output
+    m_mesh_changed = true;
 }
 
 } // namespace ascent_int
@@ -2,6 +2,7 @@
 #include <ctime>
 #include "amr-wind/utilities/console_io.H"
 #include "amr-wind/AMRWindVersion.H"
+#include "amr-wind/utilities/PerfReport.H"
 #include "AMReX.H"
 
 #ifdef AMR_WIND_USE_NETCDF
@@ -166,6 +167,7 @@ void print_mlmg_header(const std::string& key)
 
 void print_mlmg_info(const std::string& solve_name, const amrex::MLMG& mlmg)
 {
+    perf::record_solve(solve_name, mlmg);
     const int name_width = 26;
     amrex::Print() << "  " << std::setw(name_width) << std::left << solve_name
                    << std::setw(6) << std::right << mlmg.getNumIters()
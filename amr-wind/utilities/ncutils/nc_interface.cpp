@@ -568,4 +568,6 @@ void NCFile::close()
     check_nc_error(nc_close(ncid));
 }
 
+void NCFile::sync() const { check_nc_error(nc_sync(ncid)); }
+
 } // namespace ncutils
@@ -9,6 +9,163 @@
 
 namespace amr_wind::free_surface {
 
+namespace {
+
+/** Range of sample point indices `[n_f, n_a)` that fall within a cell
+ *
+ *  \param xm Cell center along the grid direction
+ *  \param dx Cell size along the grid direction
+ *  \param phi Upper bound of the domain along the grid direction
+ *  \param s Location of the first sample point
+ *  \param dxs Spacing of the sample points
+ *  \param ntps Number of sample points along the grid direction
+ */
+void sample_range(
+    const amrex::Real xm,
+    const amrex::Real dx,
+    const amrex::Real phi,
+    const amrex::Real s,
+    const amrex::Real dxs,
+    const int ntps,
+    int& n_f,
+    int& n_a)
+{
+    // Small number for floating-point comparisons
+    constexpr amrex::Real eps = 1.0e-16;
+    n_f = 0;
+    n_a = 0;
+    if (ntps == 1) {
+        n_a = ((std::abs(phi - s) < eps) ||
+               (xm - s <= 0.5 * dx && s - xm < 0.5 * dx))
+                  ? 1
+                  : 0;
+    } else {
+        n_f = (int)std::ceil((xm - 0.5 * dx - s) / dxs);
+        n_a = (int)std::ceil((xm + 0.5 * dx - s) / dxs);
+        // Edge case of phi
+        if (std::abs(xm + 0.5 * dx - phi) < eps &&
+            std::abs(s + n_a * dxs - phi) < eps) {
+            ++n_a;
+        }
+        // Bounds
+        n_a = amrex::min(ntps, n_a);
+        n_f = amrex::max(amrex::min(0, n_a), n_f);
+        // Out of bounds indicates no sample point
+        if (n_f >= ntps || n_f < 0) {
+            n_a = n_f;
+        }
+    }
+}
+
+/** Height of the interface at a sample location within a cell
+ *
+ *  Even instances look for the top of the liquid, odd instances for the top
+ *  of the gas. Returns false if the cell does not contain the requested
+ *  interface above the sample location, in which case the search continues
+ *  in the cells below.
+ */
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE bool interface_height(
+    const int i,
+    const int j,
+    const int k,
+    const int dir,
+    const int gc0,
+    const int gc1,
+    const bool odd_instance,
+    const amrex::Real loc0,
+    const amrex::Real loc1,
+    amrex::Array4<amrex::Real const> const& vof_arr,
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const& dx,
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const& dxi,
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const& plo,
+    amrex::Real& ht)
+{
+    // Cell location
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> xm;
+    xm[0] = plo[0] + (i + 0.5) * dx[0];
+    xm[1] = plo[1] + (j + 0.5) * dx[1];
+    xm[2] = plo[2] + (k + 0.5) * dx[2];
+
+    // Slope variables, normal oriented in search direction
+    amrex::Real mx = 0.0;
+    amrex::Real my = 0.0;
+    amrex::Real mz = 0.0;
+    amrex::Real alpha = 1.0;
+    switch (dir) {
+    case 0:
+        mx = 1.0;
+        break;
+    case 1:
+        my = 1.0;
+        break;
+    case 2:
+        mz = 1.0;
+        break;
+    }
+    const amrex::Real vof = vof_arr(i, j, k);
+    if ((!odd_instance && vof >= 1.0 - 1e-12) ||
+        (odd_instance && vof <= 1e-12)) {
+        // Cell is full of single phase (accounts for when interface is at
+        // intersection of cells but lower one is not single-phase), put
+        // boundary at top
+        if (odd_instance) {
+            mx *= -1.0;
+            my *= -1.0;
+            mz *= -1.0;
+            alpha *= -1.0;
+        }
+    } else if (vof < (1.0 - 1e-12) && vof > 1e-12) {
+        // Multiphase cell, get interface reconstruction
+        multiphase::fit_plane(i, j, k, vof_arr, mx, my, mz, alpha);
+    } else {
+        return false;
+    }
+
+    // Reassign slope coefficients
+    amrex::Real mdr = 0.0;
+    amrex::Real mg1 = 0.0;
+    amrex::Real mg2 = 0.0;
+    switch (dir) {
+    case 0:
+        mdr = mx;
+        mg1 = my;
+        mg2 = mz;
+        break;
+    case 1:
+        mdr = my;
+        mg1 = mx;
+        mg2 = mz;
+        break;
+    case 2:
+        mdr = mz;
+        mg1 = mx;
+        mg2 = my;
+        break;
+    }
+    // Get height of interface
+    if (mdr == 0) {
+        // If slope is undefined in z, use middle of cell
+        ht = xm[dir];
+    } else {
+        // Intersect 2D point with plane
+        ht = (xm[dir] - 0.5 * dx[dir]) +
+             (alpha - mg1 * dxi[gc0] * (loc0 - (xm[gc0] - 0.5 * dx[gc0])) -
+              mg2 * dxi[gc1] * (loc1 - (xm[gc1] - 0.5 * dx[gc1]))) /
+                 (mdr * dxi[dir]);
+    }
+    // If interface is below lower bound, continue to look
+    if (ht < xm[dir] - 0.5 * dx[dir]) {
+        return false;
+    }
+    // If interface is above upper bound, limit it
+    if (ht > xm[dir] + 0.5 * dx[dir] * (1.0 + 1e-8)) {
+        ht = xm[dir] + 0.5 * dx[dir];
+    }
+    return true;
+}
+
+} // namespace
+
 FreeSurface::FreeSurface(CFDSim& sim, std::string label)
     : m_sim(sim), m_label(std::move(label)), m_vof(sim.repo().get_field("vof"))
 {}
@@ -58,9 +215,6 @@ void FreeSurface::initialize()
         }
         }
     }
-    // Small number for floating-point comparisons
-    constexpr amrex::Real eps = 1.0e-16;
-
     // Calculate total number of points
     m_npts = m_npts_dir[0] * m_npts_dir[1];
 
@@ -91,20 +245,34 @@ void FreeSurface::initialize()
         }
     }
 
-    // Capture variables for device
+    build_columns();
+
+    if (m_out_fmt == "netcdf") {
+        prepare_netcdf_file();
+    }
+}
+
+void FreeSurface::build_columns()
+{
+    BL_PROFILE("amr-wind::FreeSurface::build_columns");
     const amrex::Real s_gc0 = m_start[m_gc0];
     const amrex::Real s_gc1 = m_start[m_gc1];
-    const int ntps0 = m_npts_dir[0];
-    const int ntps1 = m_npts_dir[1];
-    const int gc0 = m_gc0;
-    const int gc1 = m_gc1;
+    const amrex::Real dxs0 =
+        (m_end[m_gc0] - m_start[m_gc0]) / amrex::max(m_npts_dir[0] - 1, 1);
+    const amrex::Real dxs1 =
+        (m_end[m_gc1] - m_start[m_gc1]) / amrex::max(m_npts_dir[1] - 1, 1);
 
-    // Determine number of components necessary for working fields
-    int ncomp = 0;
-    const int finest_level = m_vof.repo().num_active_levels() - 1;
-    for (int lev = 0; lev <= finest_level; lev++) {
-        // Use level_mask to only count finest level present
-        amrex::iMultiFab level_mask;
+    const int nlevels = m_vof.repo().num_active_levels();
+    const int finest_level = nlevels - 1;
+    m_level_mask.clear();
+    m_level_mask.resize(nlevels);
+    m_columns.clear();
+    m_columns.resize(nlevels);
+    m_col_offsets.clear();
+    m_col_offsets.resize(nlevels);
+    for (int lev = 0; lev < nlevels; lev++) {
+        // Use level_mask to only search finest level present
+        auto& level_mask = m_level_mask[lev];
         if (lev < finest_level) {
             level_mask = makeFineMask(
                 m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
@@ -117,224 +285,50 @@ void FreeSurface::initialize()
         }
         // Get geometry information
         const auto& geom = m_sim.mesh().Geom(lev);
-        const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx =
-            geom.CellSizeArray();
-        const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> plo =
-            geom.ProbLoArray();
-        const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> phi =
-            geom.ProbHiArray();
-        ncomp = amrex::max(
-            ncomp,
-            amrex::ReduceMax(
-                level_mask, 0,
-                [=] AMREX_GPU_HOST_DEVICE(
-                    amrex::Box const& bx,
-                    amrex::Array4<int const> const& mask_arr) -> int {
-                    int ns_fab = 0;
-                    amrex::Loop(bx, [=, &ns_fab](int i, int j, int k) noexcept {
-                        // Cell location
-                        amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> xm;
-                        xm[0] = plo[0] + (i + 0.5) * dx[0];
-                        xm[1] = plo[1] + (j + 0.5) * dx[1];
-                        xm[2] = plo[2] + (k + 0.5) * dx[2];
-                        int n0_f = 0;
-                        int n0_a = 0;
-                        int n1_f = 0;
-                        int n1_a = 0;
-                        // Get first and after sample indices for gc0
-                        if (ntps0 == 1) {
-                            n0_a = ((std::abs(phi[gc0] - s_gc0) < eps) ||
-                                    (xm[gc0] - s_gc0 <= 0.5 * dx[gc0] &&
-                                     s_gc0 - xm[gc0] < 0.5 * dx[gc0]))
-                                       ? 1
-                                       : 0;
-                        } else {
-                            n0_f = (int)std::ceil(
-                                (xm[gc0] - 0.5 * dx[gc0] - s_gc0) / dxs0);
-                            n0_a = (int)std::ceil(
-                                (xm[gc0] + 0.5 * dx[gc0] - s_gc0) / dxs0);
-                            // Edge case of phi
-                            if (std::abs(xm[gc0] + 0.5 * dx[gc0] - phi[gc0]) <
-                                    eps &&
-                                std::abs(s_gc0 + n0_a * dxs0 - phi[gc0]) <
-                                    eps) {
-                                ++n0_a;
-                            }
-                            // Bounds
-                            n0_a = amrex::min(ntps0, n0_a);
-                            n0_f = amrex::max(amrex::min(0, n0_a), n0_f);
-                            // Out of bounds indicates no sample point
-                            if (n0_f >= ntps0 || n0_f < 0) {
-                                n0_a = n0_f;
-                            }
-                        }
-                        // Get first and after sample indices for gc1
-                        if (ntps1 == 1) {
-                            n1_a = (std::abs(phi[gc1] - s_gc1) < eps ||
-                                    (xm[gc1] - s_gc1 <= 0.5 * dx[gc1] &&
-                                     s_gc1 - xm[gc1] < 0.5 * dx[gc1]))
-                                       ? 1
-                                       : 0;
-                        } else {
-                            n1_f = (int)std::ceil(
-                                (xm[gc1] - 0.5 * dx[gc1] - s_gc1) / dxs1);
-                            n1_a = (int)std::ceil(
-                                (xm[gc1] + 0.5 * dx[gc1] - s_gc1) / dxs1);
-                            // Edge case of phi
-                            if (std::abs(xm[gc1] + 0.5 * dx[gc1] - phi[gc1]) <
-                                    eps &&
-                                std::abs(s_gc1 + n1_a * dxs1 - phi[gc1]) <
-                                    eps) {
-                                ++n1_a;
-                            }
-                            // Bounds
-                            n1_a = amrex::min(ntps1, n1_a);
-                            n1_f = amrex::max(amrex::min(0, n1_a), n1_f);
-                            // Out of bounds indicates no sample point
-                            if (n1_f >= ntps1 || n1_f < 0) {
-                                n1_a = n1_f;
-                            }
-                        }
-                        // Get total number of possible samples in cell
-                        int ns = (n0_a - n0_f) * (n1_a - n1_f);
-                        ns_fab = amrex::max(ns_fab, mask_arr(i, j, k) * ns);
-                    });
-                    return ns_fab;
-                }));
-    }
-    amrex::ParallelDescriptor::ReduceIntMax(ncomp);
-    // Limit number of components
-    ncomp = amrex::min(ncomp, m_ncmax);
-    // Save number of components
-    m_ncomp = ncomp;
-
-    // Declare fields for search
-    auto& floc =
-        m_sim.repo().declare_field("sample_loc_" + m_label, 2 * ncomp, 0, 1);
-    auto& fidx =
-        m_sim.repo().declare_field("sample_idx_" + m_label, ncomp, 0, 1);
-
-    // Store locations and indices in fields
-    for (int lev = 0; lev <= finest_level; lev++) {
-        // Use level_mask to only count finest level present
-        amrex::iMultiFab level_mask;
-        if (lev < finest_level) {
-            level_mask = makeFineMask(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                m_sim.mesh().boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                1, 0, amrex::MFInfo());
-            level_mask.setVal(1);
-        }
-        // Get geometry information
-        const auto& geom = m_sim.mesh().Geom(lev);
-        const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx =
-            geom.CellSizeArray();
-        const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> plo =
-            geom.ProbLoArray();
-        const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> phi =
-            geom.ProbHiArray();
-        for (amrex::MFIter mfi(floc(lev)); mfi.isValid(); ++mfi) {
-            auto loc_arr = floc(lev).array(mfi);
-            auto idx_arr = fidx(lev).array(mfi);
-            auto mask_arr = level_mask.const_array(mfi);
+        const auto& dx = geom.CellSizeArray();
+        const auto& plo = geom.ProbLoArray();
+        const auto& phi = geom.ProbHiArray();
+
+        // Sample points within the footprint of each local box, found on the
+        // host since this only depends on the grids
+        amrex::Vector<SampleColumn> columns;
+        auto& offsets = m_col_offsets[lev];
+        offsets.resize(level_mask.local_size() + 1, 0);
+        for (amrex::MFIter mfi(level_mask); mfi.isValid(); ++mfi) {
             const auto& vbx = mfi.validbox();
-            amrex::ParallelFor(
-                vbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                    // Cell location
-                    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> xm;
-                    xm[0] = plo[0] + (i + 0.5) * dx[0];
-                    xm[1] = plo[1] + (j + 0.5) * dx[1];
-                    xm[2] = plo[2] + (k + 0.5) * dx[2];
+            offsets[mfi.LocalIndex()] = static_cast<int>(columns.size());
+            for (int i1 = vbx.smallEnd(m_gc1); i1 <= vbx.bigEnd(m_gc1); ++i1) {
+                for (int i0 = vbx.smallEnd(m_gc0); i0 <= vbx.bigEnd(m_gc0);
+                     ++i0) {
                     int n0_f = 0;
                     int n0_a = 0;
                     int n1_f = 0;
                     int n1_a = 0;
-                    // Get first and after sample indices for gc0
-                    if (ntps0 == 1) {
-                        n0_a = (std::abs(phi[gc0] - s_gc0) < eps ||
-                                (xm[gc0] - s_gc0 <= 0.5 * dx[gc0] &&
-                                 s_gc0 - xm[gc0] < 0.5 * dx[gc0]))
-                                   ? 1
-                                   : 0;
-                    } else {
-                        n0_f = (int)std::ceil(
-                            (xm[gc0] - 0.5 * dx[gc0] - s_gc0) / dxs0);
-                        n0_a = (int)std::ceil(
-                            (xm[gc0] + 0.5 * dx[gc0] - s_gc0) / dxs0);
-                        // Edge case of phi
-                        if (std::abs(xm[gc0] + 0.5 * dx[gc0] - phi[gc0]) <
-                                eps &&
-                            std::abs(s_gc0 + n0_a * dxs0 - phi[gc0]) < eps) {
-                            ++n0_a;
-                        }
-                        // Bounds
-                        n0_a = amrex::min(ntps0, n0_a);
-                        n0_f = amrex::max(amrex::min(0, n0_a), n0_f);
-                        // Out of bounds indicates no sample point
-                        if (n0_f >= ntps0 || n0_f < 0) {
-                            n0_a = n0_f;
-                        }
-                    }
-                    // Get first and after sample indices for gc1
-                    if (ntps1 == 1) {
-                        n1_a = (std::abs(phi[gc1] - s_gc1) < eps ||
-                                (xm[gc1] - s_gc1 <= 0.5 * dx[gc1] &&
-                                 s_gc1 - xm[gc1] < 0.5 * dx[gc1]))
-                                   ? 1
-                                   : 0;
-                    } else {
-                        n1_f = (int)std::ceil(
-                            (xm[gc1] - 0.5 * dx[gc1] - s_gc1) / dxs1);
-                        n1_a = (int)std::ceil(
-                            (xm[gc1] + 0.5 * dx[gc1] - s_gc1) / dxs1);
-                        // Edge case of phi
-                        if (std::abs(xm[gc1] + 0.5 * dx[gc1] - phi[gc1]) <
-                                eps &&
-                            std::abs(s_gc1 + n1_a * dxs1 - phi[gc1]) < eps) {
-                            ++n1_a;
-                        }
-                        // Bounds
-                        n1_a = amrex::min(ntps1, n1_a);
-                        n1_f = amrex::max(amrex::min(0, n1_a), n1_f);
-                        // Out of bounds indicates no sample point
-                        if (n1_f >= ntps1 || n1_f < 0) {
-                            n1_a = n1_f;
-                        }
-                    }
+                    sample_range(
+                        plo[m_gc0] + (i0 + 0.5) * dx[m_gc0], dx[m_gc0],
+                        phi[m_gc0], s_gc0, dxs0, m_npts_dir[0], n0_f, n0_a);
+                    sample_range(
+                        plo[m_gc1] + (i1 + 0.5) * dx[m_gc1], dx[m_gc1],
+                        phi[m_gc1], s_gc1, dxs1, m_npts_dir[1], n1_f, n1_a);
                     // Loop through local sample locations
                     int ns = 0;
-                    for (int n0 = n0_f; n0 < n0_a; ++n0) {
-                        for (int n1 = n1_f; n1 < n1_a; ++n1) {
-                            // Save index and location
-                            idx_arr(i, j, k, ns) = (amrex::Real)n1 * ntps0 + n0;
-                            loc_arr(i, j, k, 2 * ns) = s_gc0 + n0 * dxs0;
-                            loc_arr(i, j, k, 2 * ns + 1) = s_gc1 + n1 * dxs1;
-                            // Advance to next point
+                    for (int n0 = n0_f; n0 < n0_a && ns < m_ncmax; ++n0) {
+                        for (int n1 = n1_f; n1 < n1_a && ns < m_ncmax; ++n1) {
+                            columns.push_back(
+                                {i0, i1, n1 * m_npts_dir[0] + n0,
+                                 s_gc0 + n0 * dxs0, s_gc1 + n1 * dxs1});
                             ++ns;
-                            // if ns gets to max components, break
-                            if (ns == ncomp) {
-                                break;
-                            }
                         }
-                        if (ns == ncomp) {
-                            break;
-                        }
-                    }
-                    // Set remaining values to -1 to indicate no point
-                    // or set all values to -1 if not in fine mesh
-                    int nstart = (mask_arr(i, j, k) == 0) ? 0 : ns;
-                    for (int n = nstart; n < ncomp; ++n) {
-                        idx_arr(i, j, k, n) = -1.0;
                     }
-                });
+                }
+            }
         }
-    }
+        offsets.back() = static_cast<int>(columns.size());
 
-    if (m_out_fmt == "netcdf") {
-        prepare_netcdf_file();
+        m_columns[lev].resize(columns.size());
+        amrex::Gpu::copy(
+            amrex::Gpu::hostToDevice, columns.begin(), columns.end(),
+            m_columns[lev].begin());
     }
 }
 
@@ -363,23 +357,17 @@ void FreeSurface::post_advance_work()
         m_npts, phi0[m_coorddir] + 1.0);
     auto* dlst_ptr = dout_last.data();
 
-    // Get working fields
-    auto& fidx = m_sim.repo().get_field("sample_idx_" + m_label);
-    auto& floc = m_sim.repo().get_field("sample_loc_" + m_label);
-
     const int finest_level = m_vof.repo().num_active_levels() - 1;
 
     // Capture integers for device
     const int dir = m_coorddir;
     const int gc0 = m_gc0;
     const int gc1 = m_gc1;
-    const int ncomp = m_ncomp;
 
     // Loop instances
     for (int ni = 0; ni < m_ninst; ++ni) {
+        const bool odd_instance = (ni % 2 != 0);
         for (int lev = 0; lev <= finest_level; lev++) {
-            // Level mask info is built into idx info
-
             // Get geometry information
             const auto& geom = m_sim.mesh().Geom(lev);
             const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx =
@@ -388,136 +376,46 @@ void FreeSurface::post_advance_work()
                 geom.InvCellSizeArray();
             const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> plo =
                 geom.ProbLoArray();
-            for (amrex::MFIter mfi(floc(lev)); mfi.isValid(); ++mfi) {
-                auto loc_arr = floc(lev).const_array(mfi);
-                auto idx_arr = fidx(lev).const_array(mfi);
+            const auto& offsets = m_col_offsets[lev];
+            for (amrex::MFIter mfi(m_vof(lev)); mfi.isValid(); ++mfi) {
+                const int cbeg = offsets[mfi.LocalIndex()];
+                const int ncols = offsets[mfi.LocalIndex() + 1] - cbeg;
+                if (ncols == 0) {
+                    continue;
+                }
+                const auto* cols = m_columns[lev].data() + cbeg;
                 auto vof_arr = m_vof(lev).const_array(mfi);
+                auto mask_arr = m_level_mask[lev].const_array(mfi);
                 const auto& vbx = mfi.validbox();
-                amrex::ParallelFor(
-                    vbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        // Cell location
-                        amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> xm;
-                        xm[0] = plo[0] + (i + 0.5) * dx[0];
-                        xm[1] = plo[1] + (j + 0.5) * dx[1];
-                        xm[2] = plo[2] + (k + 0.5) * dx[2];
-                        // Loop number of components
-                        for (int n = 0; n < ncomp; ++n) {
-                            // Get index of current component and cell
-                            const int idx =
-                                (int)std::round(idx_arr(i, j, k, n));
-                            // Proceed if there is sample point at this i,j,k,n
-                            // and that cell height is below previous instance
-                            if (idx >= 0 && dlst_ptr[amrex::max(0, idx)] >
-                                                xm[dir] + 0.5 * dx[dir]) {
-                                // Get sample locations from field loc
-                                amrex::Real loc0 = loc_arr(i, j, k, 2 * n);
-                                amrex::Real loc1 = loc_arr(i, j, k, 2 * n + 1);
-
-                                // Indices and slope variables
-                                amrex::Real mx = 0.0;
-                                amrex::Real my = 0.0;
-                                amrex::Real mz = 0.0;
-                                amrex::Real alpha = 1.0;
-                                // Get modified indices for checking up
-                                // and down and orient normal in search
-                                // direction
-                                switch (dir) {
-                                case 0:
-                                    mx = 1.0;
-                                    break;
-                                case 1:
-                                    my = 1.0;
-                                    break;
-                                case 2:
-                                    mz = 1.0;
-                                    break;
-                                }
-                                // If cell is full of single phase
-                                // (accounts for when interface is at
-                                // intersection of cells but lower one
-                                // is not single-phase)
-                                bool calc_flag = false;
-                                if ((ni % 2 == 0 &&
-                                     vof_arr(i, j, k) >= 1.0 - 1e-12) ||
-                                    (ni % 2 != 0 &&
-                                     vof_arr(i, j, k) <= 1e-12)) {
-                                    // put bdy at top
-                                    alpha = 1.0;
-                                    if (ni % 2 != 0) {
-                                        mx *= -1.0;
-                                        my *= -1.0;
-                                        mz *= -1.0;
-                                        alpha *= -1.0;
-                                    }
-                                    calc_flag = true;
-                                }
-                                // Multiphase cell case
-                                if (vof_arr(i, j, k) < (1.0 - 1e-12) &&
-                                    vof_arr(i, j, k) > 1e-12) {
-                                    // Get interface reconstruction
-                                    multiphase::fit_plane(
-                                        i, j, k, vof_arr, mx, my, mz, alpha);
-                                    calc_flag = true;
-                                }
-
-                                if (calc_flag) {
-                                    // Initialize height measurement
-                                    amrex::Real ht = plo[dir];
-                                    // Reassign slope coefficients
-                                    amrex::Real mdr = 0.0;
-                                    amrex::Real mg1 = 0.0;
-                                    amrex::Real mg2 = 0.0;
-                                    switch (dir) {
-                                    case 0:
-                                        mdr = mx;
-                                        mg1 = my;
-                                        mg2 = mz;
-                                        break;
-                                    case 1:
-                                        mdr = my;
-                                        mg1 = mx;
-                                        mg2 = mz;
-                                        break;
-                                    case 2:
-                                        mdr = mz;
-                                        mg1 = mx;
-                                        mg2 = my;
-                                        break;
-                                    }
-                                    // Get height of interface
-                                    if (mdr == 0) {
-                                        // If slope is undefined in z,
-                                        // use middle of cell
-                                        ht = xm[dir];
-                                    } else {
-                                        // Intersect 2D point with plane
-                                        ht = (xm[dir] - 0.5 * dx[dir]) +
-                                             (alpha -
-                                              mg1 * dxi[gc0] *
-                                                  (loc0 -
-                                                   (xm[gc0] - 0.5 * dx[gc0])) -
-                                              mg2 * dxi[gc1] *
-                                                  (loc1 -
-                                                   (xm[gc1] - 0.5 * dx[gc1]))) /
-                                                 (mdr * dxi[dir]);
-                                    }
-                                    // If interface is below lower
-                                    // bound, continue to look
-                                    if (ht < xm[dir] - 0.5 * dx[dir]) {
-                                        ht = plo[dir];
-                                    }
-                                    // If interface is above upper
-                                    // bound, limit it
-                                    if (ht > xm[dir] +
-                                                 0.5 * dx[dir] * (1.0 + 1e-8)) {
-                                        ht = xm[dir] + 0.5 * dx[dir];
-                                    }
-                                    // Save interface location by atomic max
-                                    amrex::Gpu::Atomic::Max(&dout_ptr[idx], ht);
-                                }
-                            }
+                const int klo = vbx.smallEnd(dir);
+                const int khi = vbx.bigEnd(dir);
+                amrex::ParallelFor(ncols, [=] AMREX_GPU_DEVICE(int n) noexcept {
+                    const auto& col = cols[n];
+                    const amrex::Real hlast = dlst_ptr[col.idx];
+                    amrex::IntVect iv;
+                    iv[gc0] = col.i0;
+                    iv[gc1] = col.i1;
+                    // Search down the column for the highest interface below
+                    // the one found by the previous instance. Cells are
+                    // disjoint along the column, so the first height found is
+                    // the maximum within this box.
+                    for (int kk = khi; kk >= klo; --kk) {
+                        iv[dir] = kk;
+                        const amrex::Real xtop =
+                            plo[dir] + (kk + 0.5) * dx[dir] + 0.5 * dx[dir];
+                        if (mask_arr(iv) == 0 || !(hlast > xtop)) {
+                            continue;
+                        }
+                        amrex::Real ht = plo[dir];
+                        if (interface_height(
+                                iv[0], iv[1], iv[2], dir, gc0, gc1,
+                                odd_instance, col.loc0, col.loc1, vof_arr, dx,
+                                dxi, plo, ht)) {
+                            amrex::Gpu::Atomic::Max(&dout_ptr[col.idx], ht);
+                            break;
                         }
-                    });
+                    }
+                });
             }
         }
 
@@ -525,10 +423,9 @@ void FreeSurface::post_advance_work()
         amrex::Gpu::copy(
             amrex::Gpu::deviceToHost, dout.begin(), dout.end(),
             &m_out[static_cast<long>(ni) * m_npts]);
-        // Make consistent across parallelization
-        for (int n = 0; n < m_npts; n++) {
-            amrex::ParallelDescriptor::ReduceRealMax(m_out[ni * m_npts + n]);
-        }
+        // Make consistent across parallelization, all points at once
+        amrex::ParallelDescriptor::ReduceRealMax(
+            &m_out[static_cast<long>(ni) * m_npts], m_npts);
         // Copy last m_out to device vector of results of last instance
         amrex::Gpu::copy(
             amrex::Gpu::hostToDevice, &m_out[static_cast<long>(ni) * m_npts],
@@ -546,143 +443,7 @@ void FreeSurface::post_advance_work()
 void FreeSurface::post_regrid_actions()
 {
     BL_PROFILE("amr-wind::FreeSurface::post_regrid_actions");
-    // Small number for floating-point comparisons
-    constexpr amrex::Real eps = 1.0e-16;
-    // Get working fields
-    auto& fidx = m_sim.repo().get_field("sample_idx_" + m_label);
-    auto& floc = m_sim.repo().get_field("sample_loc_" + m_label);
-    // Provide variables from class to device
-    const int ncomp = m_ncomp;
-    const int ntps0 = m_npts_dir[0];
-    const int ntps1 = m_npts_dir[1];
-    const int gc0 = m_gc0;
-    const int gc1 = m_gc1;
-    const amrex::Real s_gc0 = m_start[m_gc0];
-    const amrex::Real s_gc1 = m_start[m_gc1];
-    const amrex::Real dxs0 =
-        (m_end[m_gc0] - m_start[m_gc0]) / amrex::max(m_npts_dir[0] - 1, 1);
-    const amrex::Real dxs1 =
-        (m_end[m_gc1] - m_start[m_gc1]) / amrex::max(m_npts_dir[1] - 1, 1);
-
-    // Store locations and indices in fields
-    const int finest_level = m_vof.repo().num_active_levels() - 1;
-    for (int lev = 0; lev <= finest_level; lev++) {
-        // Use level_mask to only count finest level present
-        amrex::iMultiFab level_mask;
-        if (lev < finest_level) {
-            level_mask = makeFineMask(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                m_sim.mesh().boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                1, 0, amrex::MFInfo());
-            level_mask.setVal(1);
-        }
-        // Get geometry information
-        const auto& geom = m_sim.mesh().Geom(lev);
-        const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx =
-            geom.CellSizeArray();
-        const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> plo =
-            geom.ProbLoArray();
-        const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> phi =
-            geom.ProbHiArray();
-        for (amrex::MFIter mfi(floc(lev)); mfi.isValid(); ++mfi) {
-            auto loc_arr = floc(lev).array(mfi);
-            auto idx_arr = fidx(lev).array(mfi);
-            auto mask_arr = level_mask.const_array(mfi);
-            const auto& vbx = mfi.validbox();
-            amrex::ParallelFor(
-                vbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                    // Cell location
-                    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> xm;
-                    xm[0] = plo[0] + (i + 0.5) * dx[0];
-                    xm[1] = plo[1] + (j + 0.5) * dx[1];
-                    xm[2] = plo[2] + (k + 0.5) * dx[2];
-                    int n0_f = 0;
-                    int n0_a = 0;
-                    int n1_f = 0;
-                    int n1_a = 0;
-                    // Get first and after sample indices for gc0
-                    if (ntps0 == 1) {
-                        n0_a = (std::abs(phi[gc0] - s_gc0) < eps ||
-                                (xm[gc0] - s_gc0 <= 0.5 * dx[gc0] &&
-                                 s_gc0 - xm[gc0] < 0.5 * dx[gc0]))
-                                   ? 1
-                                   : 0;
-                    } else {
-                        n0_f = (int)std::ceil(
-                            (xm[gc0] - 0.5 * dx[gc0] - s_gc0) / dxs0);
-                        n0_a = (int)std::ceil(
-                            (xm[gc0] + 0.5 * dx[gc0] - s_gc0) / dxs0);
-                        // Edge case of phi
-                        if (std::abs(xm[gc0] + 0.5 * dx[gc0] - phi[gc0]) <
-                                eps &&
-                            std::abs(s_gc0 + n0_a * dxs0 - phi[gc0]) < eps) {
-                            ++n0_a;
-                        }
-                        // Bounds
-                        n0_a = amrex::min(ntps0, n0_a);
-                        n0_f = amrex::max(amrex::min(0, n0_a), n0_f);
-                        // Out of bounds indicates no sample point
-                        if (n0_f >= ntps0 || n0_f < 0) {
-                            n0_a = n0_f;
-                        }
-                    }
-                    // Get first and after sample indices for gc1
-                    if (ntps1 == 1) {
-                        n1_a = (std::abs(phi[gc1] - s_gc1) < eps ||
-                                (xm[gc1] - s_gc1 <= 0.5 * dx[gc1] &&
-                                 s_gc1 - xm[gc1] < 0.5 * dx[gc1]))
-                                   ? 1
-                                   : 0;
-                    } else {
-                        n1_f = (int)std::ceil(
-                            (xm[gc1] - 0.5 * dx[gc1] - s_gc1) / dxs1);
-                        n1_a = (int)std::ceil(
-                            (xm[gc1] + 0.5 * dx[gc1] - s_gc1) / dxs1);
-                        // Edge case of phi
-                        if (std::abs(xm[gc1] + 0.5 * dx[gc1] - phi[gc1]) <
-                                eps &&
-                            std::abs(s_gc1 + n1_a * dxs1 - phi[gc1]) < eps) {
-                            ++n1_a;
-                        }
-                        // Bounds
-                        n1_a = amrex::min(ntps1, n1_a);
-                        n1_f = amrex::max(amrex::min(0, n1_a), n1_f);
-                        // Out of bounds indicates no sample point
-                        if (n1_f >= ntps1 || n1_f < 0) {
-                            n1_a = n1_f;
-                        }
-                    }
-                    // Loop through local sample locations
-                    int ns = 0;
-                    for (int n0 = n0_f; n0 < n0_a; ++n0) {
-                        for (int n1 = n1_f; n1 < n1_a; ++n1) {
-                            // Save index and location
-                            idx_arr(i, j, k, ns) = (amrex::Real)n1 * ntps0 + n0;
-                            loc_arr(i, j, k, 2 * ns) = s_gc0 + n0 * dxs0;
-                            loc_arr(i, j, k, 2 * ns + 1) = s_gc1 + n1 * dxs1;
-                            // Advance to next point
-                            ++ns;
-                            // if ns gets to max components, break
-                            if (ns == ncomp) {
-                                break;
-                            }
-                        }
-                        if (ns == ncomp) {
-                            break;
-                        }
-                    }
-                    // Set remaining values to -1 to indicate no point
-                    // or set all values to -1 if not in fine mesh
-                    int nstart = (mask_arr(i, j, k) == 0) ? 0 : ns;
-                    for (int n = nstart; n < ncomp; ++n) {
-                        idx_arr(i, j, k, n) = -1.0;
-                    }
-                });
-        }
-    }
+    build_columns();
 }
 
 void FreeSurface::process_output()
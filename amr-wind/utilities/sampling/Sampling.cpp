@@ -4,6 +4,7 @@
 #include "amr-wind/utilities/sampling/Sampling.H"
 #include "amr-wind/utilities/io_utils.H"
 #include "amr-wind/utilities/ncutils/nc_interface.H"
+#include "amr-wind/utilities/PerfReport.H"
 
 #include "AMReX_ParmParse.H"
 
@@ -13,7 +14,7 @@ Sampling::Sampling(CFDSim& sim, std::string label)
     : m_sim(sim), m_label(std::move(label))
 {}
 
-Sampling::~Sampling() = default;
+Sampling::~Sampling() { flush_netcdf(); }
 
 void Sampling::initialize()
 {
@@ -31,6 +32,8 @@ void Sampling::initialize()
         pp.query("output_frequency", m_out_freq);
         pp.query("output_format", m_out_fmt);
         pp.query("output_delay", m_out_delay);
+        pp.query("netcdf_buffer_steps", m_nc_buffer_steps);
+        AMREX_ALWAYS_ASSERT(m_nc_buffer_steps > 0);
     }
 
     // Process field information
@@ -104,6 +107,7 @@ void Sampling::post_advance_work()
 {
 
     BL_PROFILE("amr-wind::Sampling::post_advance_work");
+    perf::ScopedTimer perf_timer(perf::Region::sampling);
     const auto& time = m_sim.time();
     const int tidx = time.time_index();
     // Skip processing if delay has not been reached
@@ -238,46 +242,84 @@ void Sampling::prepare_netcdf_file()
 void Sampling::write_netcdf()
 {
 #ifdef AMR_WIND_USE_NETCDF
-    std::vector<double> buf(m_total_particles * m_var_names.size(), 0.0);
+    BL_PROFILE("amr-wind::Sampling::write_netcdf");
+    const size_t nvals = m_total_particles * m_var_names.size();
+    std::vector<double> buf(nvals, 0.0);
     m_scontainer->populate_buffer(buf);
 
     if (!amrex::ParallelDescriptor::IOProcessor()) return;
-    auto ncf = ncutils::NCFile::open(m_ncfile_name, NC_WRITE);
-    const std::string nt_name = "num_time_steps";
+
+    // Open the file once and keep it open for subsequent output steps
+    if (!m_ncf) {
+        m_ncf = std::make_unique<ncutils::NCFile>(
+            ncutils::NCFile::open(m_ncfile_name, NC_WRITE));
+        m_nc_start = m_ncf->dim("num_time_steps").len();
+        m_nc_buffer.resize(nvals * m_nc_buffer_steps);
+    }
+
     // Index of the next timestep
-    const size_t nt = ncf.dim(nt_name).len();
+    const size_t nt = m_nc_start + m_nc_buffered;
     {
         auto time = m_sim.time().new_time();
-        ncf.var("time").put(&time, {nt}, {1});
+        m_ncf->var("time").put(&time, {nt}, {1});
     }
 
     for (const auto& obj : m_samplers) {
-        auto grp = ncf.group(obj->label());
+        auto grp = m_ncf->group(obj->label());
         obj->output_netcdf_data(grp, nt);
     }
 
-    std::vector<size_t> start{nt, 0};
-    std::vector<size_t> count{1, 0};
+    std::copy(
+        buf.begin(), buf.end(), m_nc_buffer.begin() + m_nc_buffered * nvals);
+    ++m_nc_buffered;
+
+    if (m_nc_buffered >= m_nc_buffer_steps) {
+        flush_netcdf();
+    }
+#endif
+}
+
+void Sampling::flush_netcdf()
+{
+#ifdef AMR_WIND_USE_NETCDF
+    if ((m_nc_buffered < 1) || !m_ncf) return;
+    BL_PROFILE("amr-wind::Sampling::flush_netcdf");
+
+    const size_t nvals = m_total_particles * m_var_names.size();
+    const size_t nsteps = m_nc_buffered;
+    std::vector<size_t> start{m_nc_start, 0};
+    std::vector<size_t> count{nsteps, 0};
+    std::vector<double> vbuf;
 
     const int nvars = m_var_names.size();
     for (int iv = 0; iv < nvars; ++iv) {
-        start[1] = 0;
-        count[1] = 0;
         int offset = iv * m_scontainer->num_sampling_particles();
         for (const auto& obj : m_samplers) {
-            auto grp = ncf.group(obj->label());
+            auto grp = m_ncf->group(obj->label());
             auto var = grp.var(m_var_names[iv]);
+            const size_t npts = obj->num_points();
+
+            // Collect the buffered steps for this sampler contiguously
+            vbuf.resize(nsteps * npts);
+            for (size_t it = 0; it < nsteps; ++it) {
+                const auto src = m_nc_buffer.begin() + it * nvals + offset;
+                std::copy(src, src + npts, vbuf.begin() + it * npts);
+            }
+
             // Do sampler specific output if needed
-            bool do_output = obj->output_netcdf_field(&buf[offset], var);
+            bool do_output = obj->output_netcdf_field(vbuf.data(), var);
             // Do generic output if specific output returns true
             if (do_output) {
-                count[1] = obj->num_points();
-                var.put(&buf[offset], start, count);
+                count[1] = npts;
+                var.put(vbuf.data(), start, count);
                 offset += count[1];
             }
         }
     }
-    ncf.close();
+    m_ncf->sync();
+
+    m_nc_start += m_nc_buffered;
+    m_nc_buffered = 0;
 #endif
 }
 
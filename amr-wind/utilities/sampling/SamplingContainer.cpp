@@ -222,37 +222,87 @@ void SamplingContainer::interpolate_fields(const amrex::Vector<Field*> fields)
     }
 }
 
+/** Populate the buffer on the I/O processor with data for all the particles
+ *
+ *  Each rank packs the unique ID and sampled values of the particles that it
+ *  owns and the packed records are gathered on the I/O processor, which
+ *  scatters them into the dense buffer. The buffer is only populated on the
+ *  I/O processor.
+ */
 void SamplingContainer::populate_buffer(std::vector<double>& buf)
 {
     BL_PROFILE("amr-wind::SamplingContainer::populate_buffer");
 
-    amrex::Gpu::DeviceVector<double> dbuf(buf.size(), 0.0);
-    auto* dbuf_ptr = dbuf.data();
+    const int ncomp = NumRuntimeRealComps();
+    const int nrec = ncomp + 1;
     const int nlevels = m_mesh.finestLevel() + 1;
+
+    int nlocal = 0;
     for (int lev = 0; lev < nlevels; ++lev) {
-        for (int fid = 0; fid < NumRuntimeRealComps(); ++fid) {
-            const int offset = fid * num_sampling_particles();
-            for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
-                const int np = pti.numParticles();
-                auto* pstruct = pti.GetArrayOfStructs()().data();
-                auto* parr = pti.GetStructOfArrays().GetRealData(fid).data();
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            nlocal += pti.numParticles();
+        }
+    }
 
+    // Pack records of (uid, values) for the locally owned particles
+    amrex::Gpu::DeviceVector<double> dbuf(nlocal * nrec, 0.0);
+    auto* dbuf_ptr = dbuf.data();
+    int poffset = 0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            const int np = pti.numParticles();
+            auto* pstruct = pti.GetArrayOfStructs()().data();
+            auto* dptr = dbuf_ptr + static_cast<size_t>(poffset) * nrec;
+
+            amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                dptr[ip * nrec] =
+                    static_cast<double>(pstruct[ip].idata(IIx::uid));
+            });
+
+            for (int fid = 0; fid < ncomp; ++fid) {
+                auto* parr = pti.GetStructOfArrays().GetRealData(fid).data();
                 amrex::ParallelFor(
                     np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
-                        auto& pp = pstruct[ip];
-                        const int pidx = pp.idata(IIx::uid);
-                        const int ii = offset + pidx;
-                        dbuf_ptr[ii] = parr[ip];
+                        dptr[ip * nrec + fid + 1] = parr[ip];
                     });
             }
+            poffset += np;
         }
     }
 
+    std::vector<double> lbuf(dbuf.size());
     amrex::Gpu::copy(
-        amrex::Gpu::deviceToHost, dbuf.begin(), dbuf.end(), buf.begin());
-    amrex::ParallelDescriptor::ReduceRealSum(
-        buf.data(), static_cast<int>(buf.size()),
-        amrex::ParallelDescriptor::IOProcessorNumber());
+        amrex::Gpu::deviceToHost, dbuf.begin(), dbuf.end(), lbuf.begin());
+
+    const int iproc = amrex::ParallelDescriptor::IOProcessorNumber();
+    const int nsend = nlocal * nrec;
+    const auto rcounts = amrex::ParallelDescriptor::Gather(nsend, iproc);
+
+    std::vector<int> rdisp;
+    std::vector<double> gbuf;
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        rdisp.resize(rcounts.size(), 0);
+        for (int i = 1; i < static_cast<int>(rcounts.size()); ++i) {
+            rdisp[i] = rdisp[i - 1] + rcounts[i - 1];
+        }
+        gbuf.resize(rdisp.back() + rcounts.back());
+    }
+    amrex::ParallelDescriptor::Gatherv(
+        lbuf.data(), nsend, gbuf.data(), rcounts, rdisp, iproc);
+
+    if (!amrex::ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+
+    const int npart = num_sampling_particles();
+    const int nrecv = static_cast<int>(gbuf.size()) / nrec;
+    for (int ir = 0; ir < nrecv; ++ir) {
+        const double* rec = &gbuf[static_cast<size_t>(ir) * nrec];
+        const int pidx = static_cast<int>(rec[0]);
+        for (int fid = 0; fid < ncomp; ++fid) {
+            buf[fid * npart + pidx] = rec[fid + 1];
+        }
+    }
 }
 
 } // namespace amr_wind::sampling
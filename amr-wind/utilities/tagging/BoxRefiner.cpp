@@ -90,6 +90,17 @@ BoxRefiner::BoxRefiner(const CFDSim& /*unused*/, const std::string& key)
         amrex::Print() << hex_corners[i] << std::endl;
     }
 
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        amrex::Real lo = hex_corners[0][d];
+        amrex::Real hi = hex_corners[0][d];
+        for (int i = 1; i < 8; ++i) {
+            lo = amrex::min(lo, hex_corners[i][d]);
+            hi = amrex::max(hi, hex_corners[i][d]);
+        }
+        m_bbox.setLo(d, lo);
+        m_bbox.setHi(d, hi);
+    }
+
     // Setup data on device
     m_hex_corners.resize(8);
     m_face_normals.resize(6);
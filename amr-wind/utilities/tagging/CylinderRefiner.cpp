@@ -32,6 +32,21 @@ CylinderRefiner::CylinderRefiner(
     pp.query("inner_radius", m_inner_radius);
 }
 
+amrex::RealBox CylinderRefiner::bounding_box() const
+{
+    // Extent of the end caps normal to the axis in each direction
+    const auto axis = (m_end - m_start).unit();
+    amrex::RealBox bbox;
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        const amrex::Real ext =
+            m_outer_radius *
+            std::sqrt(amrex::max(0.0, 1.0 - axis[i] * axis[i]));
+        bbox.setLo(i, amrex::min(m_start[i], m_end[i]) - ext);
+        bbox.setHi(i, amrex::max(m_start[i], m_end[i]) + ext);
+    }
+    return bbox;
+}
+
 void CylinderRefiner::operator()(
     const amrex::Box& bx,
     const amrex::Geometry& geom,
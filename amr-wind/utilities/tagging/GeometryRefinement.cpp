@@ -1,13 +1,17 @@
 #include "amr-wind/utilities/tagging/GeometryRefinement.H"
 #include "amr-wind/CFDSim.H"
 
+#include <tuple>
+
 #include "AMReX.H"
 #include "AMReX_ParmParse.H"
 
 namespace amr_wind {
 
 GeometryRefinement::GeometryRefinement(const CFDSim& sim)
-    : m_sim(sim), m_max_level(m_sim.mesh().maxLevel())
+    : m_sim(sim)
+    , m_tag_cache(sim.mesh().maxLevel() + 1)
+    , m_max_level(m_sim.mesh().maxLevel())
 {}
 
 void GeometryRefinement::initialize(const std::string& key)
@@ -19,6 +23,7 @@ void GeometryRefinement::initialize(const std::string& key)
         pp.query("level", m_set_level);
         pp.query("min_level", m_min_level);
         pp.query("max_level", m_max_level);
+        pp.query("cache_tags", m_cache_tags);
     }
 
     for (const auto& geom : shapes) {
@@ -29,6 +34,23 @@ void GeometryRefinement::initialize(const std::string& key)
         auto obj = tagging::GeometryType::create(gtype, m_sim, args);
         m_geom_refiners.emplace_back(std::move(obj));
     }
+
+    amrex::Vector<amrex::RealBox> bboxes;
+    for (const auto& gg : m_geom_refiners) {
+        bboxes.push_back(gg->bounding_box());
+    }
+    m_shape_tree.build(bboxes);
+}
+
+void GeometryRefinement::tag_box(
+    const amrex::Box& bx,
+    const amrex::Geometry& geom,
+    const amrex::Vector<int>& shapes,
+    const amrex::Array4<amrex::TagBox::TagType>& tag) const
+{
+    for (const int ishape : shapes) {
+        (*m_geom_refiners[ishape])(bx, geom, tag);
+    }
 }
 
 void GeometryRefinement::operator()(
@@ -45,23 +67,94 @@ void GeometryRefinement::operator()(
         return;
     }
 
+    BL_PROFILE("amr-wind::GeometryRefinement");
     const auto& mesh = m_sim.mesh();
     const auto& geom = mesh.Geom(level);
+    const auto& problo = geom.ProbLoArray();
+    const auto& dx = geom.CellSizeArray();
 
     // We are always guaranteed to have at least one field
     const auto& field_fab = (*m_sim.repo().fields()[0])(level);
 
+    // Physical extents of a box used to find the shapes that intersect it
+    auto real_box = [&](const amrex::Box& bx) {
+        amrex::RealBox rbx;
+        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+            rbx.setLo(i, problo[i] + bx.smallEnd(i) * dx[i]);
+            rbx.setHi(i, problo[i] + (bx.bigEnd(i) + 1) * dx[i]);
+        }
+        return rbx;
+    };
+
+    if (!m_cache_tags) {
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
+        for (amrex::MFIter mfi(field_fab); mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.tilebox();
+            amrex::Vector<int> shapes;
+            m_shape_tree.query(real_box(bx), shapes);
+            tag_box(bx, geom, shapes, tags.array(mfi));
+        }
+        return;
+    }
+
+    // The shapes are static, so the tags of boxes that did not change since
+    // the last regrid are reused. Boxes that do not intersect any shape are
+    // not stored. The cache only retains the boxes of the current grids.
+    auto& old_cache = m_tag_cache[level];
+    TagCache cache;
+    amrex::Vector<amrex::Box> new_boxes;
+    amrex::Vector<amrex::Vector<int>> new_shapes;
     for (amrex::MFIter mfi(field_fab); mfi.isValid(); ++mfi) {
         const auto& bx = mfi.tilebox();
-        const auto& tag = tags.array(mfi);
+        auto it = old_cache.find(bx);
+        if (it != old_cache.end()) {
+            cache.emplace(bx, std::move(it->second));
+            continue;
+        }
 
-        for (const auto& gg : m_geom_refiners) {
-            (*gg)(bx, geom, tag);
+        amrex::Vector<int> shapes;
+        m_shape_tree.query(real_box(bx), shapes);
+        if (!shapes.empty()) {
+            cache.emplace(
+                std::piecewise_construct, std::forward_as_tuple(bx),
+                std::forward_as_tuple(bx, 1));
+            new_boxes.push_back(bx);
+            new_shapes.push_back(std::move(shapes));
         }
     }
+
+    // Evaluate the shapes on the new boxes
+#ifdef AMREX_USE_OMP
+#pragma omp parallel for if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (int i = 0; i < new_boxes.size(); ++i) {
+        auto& fab = cache.at(new_boxes[i]);
+        fab.setVal<amrex::RunOn::Device>(amrex::TagBox::CLEAR);
+        tag_box(new_boxes[i], geom, new_shapes[i], fab.array());
+    }
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(field_fab); mfi.isValid(); ++mfi) {
+        const auto& bx = mfi.tilebox();
+        const auto it = cache.find(bx);
+        if (it == cache.end()) {
+            continue;
+        }
+
+        const auto& cached = it->second.const_array();
+        const auto& tag = tags.array(mfi);
+        amrex::ParallelFor(
+            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                if (cached(i, j, k) == amrex::TagBox::SET) {
+                    tag(i, j, k) = amrex::TagBox::SET;
+                }
+            });
+    }
+    old_cache = std::move(cache);
 }
 
 } // namespace amr_wind
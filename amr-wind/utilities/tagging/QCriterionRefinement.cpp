@@ -1,5 +1,6 @@
 #include "amr-wind/utilities/tagging/QCriterionRefinement.H"
 #include "amr-wind/CFDSim.H"
+#include "amr-wind/core/VelocityGradient.H"
 
 #include "AMReX.H"
 #include "AMReX_ParmParse.H"
@@ -56,52 +57,23 @@ void QCriterionRefinement::operator()(
 
     m_vel->fillpatch(level, time, (*m_vel)(level), 1);
 
-    const auto& mfab = (*m_vel)(level);
-    const auto& idx = m_sim.repo().mesh().Geom(level).InvCellSizeArray();
-
+    const auto& grad = m_sim.velocity_gradient()(level, FieldState::New);
     const auto nondim = m_nondim;
 
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
-    for (amrex::MFIter mfi(mfab, amrex::TilingIfNotGPU()); mfi.isValid();
+    for (amrex::MFIter mfi(grad, amrex::TilingIfNotGPU()); mfi.isValid();
          ++mfi) {
         const auto& bx = mfi.tilebox();
         const auto& tag = tags.array(mfi);
-        const auto& vel = mfab.const_array(mfi);
+        const auto& garr = grad.const_array(mfi);
         const auto qc_val = m_qc_value[level];
 
         amrex::ParallelFor(
             bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                // TODO: ignoring wall stencils for now
-                const auto ux =
-                    0.5 * (vel(i + 1, j, k, 0) - vel(i - 1, j, k, 0)) * idx[0];
-                const auto vx =
-                    0.5 * (vel(i + 1, j, k, 1) - vel(i - 1, j, k, 1)) * idx[0];
-                const auto wx =
-                    0.5 * (vel(i + 1, j, k, 2) - vel(i - 1, j, k, 2)) * idx[0];
-
-                const auto uy =
-                    0.5 * (vel(i, j + 1, k, 0) - vel(i, j - 1, k, 0)) * idx[1];
-                const auto vy =
-                    0.5 * (vel(i, j + 1, k, 1) - vel(i, j - 1, k, 1)) * idx[1];
-                const auto wy =
-                    0.5 * (vel(i, j + 1, k, 2) - vel(i, j - 1, k, 2)) * idx[1];
-
-                const auto uz =
-                    0.5 * (vel(i, j, k + 1, 0) - vel(i, j, k - 1, 0)) * idx[2];
-                const auto vz =
-                    0.5 * (vel(i, j, k + 1, 1) - vel(i, j, k - 1, 1)) * idx[2];
-                const auto wz =
-                    0.5 * (vel(i, j, k + 1, 2) - vel(i, j, k - 1, 2)) * idx[2];
-
-                const auto S2 =
-                    ux * ux + vy * vy + wz * wz + 0.5 * std::pow(uy + vx, 2) +
-                    0.5 * std::pow(vz + wy, 2) + 0.5 * std::pow(wx + uz, 2);
-
-                const auto W2 = 0.5 * std::pow(uy - vx, 2) +
-                                0.5 * std::pow(vz - wy, 2) +
-                                0.5 * std::pow(wx - uz, 2);
+                amrex::Real S2, W2;
+                VelocityGradient::strain_rotation(garr, i, j, k, S2, W2);
 
                 const auto qc = 0.5 * (W2 - S2);
                 const auto qc_nondim =
@@ -1,5 +1,6 @@
 #include "amr-wind/utilities/tagging/VorticityMagRefinement.H"
 #include "amr-wind/CFDSim.H"
+#include "amr-wind/core/VelocityGradient.H"
 
 #include "AMReX.H"
 #include "AMReX_ParmParse.H"
@@ -54,40 +55,22 @@ void VorticityMagRefinement::operator()(
 
     m_vel->fillpatch(level, time, (*m_vel)(level), 1);
 
-    const auto& mfab = (*m_vel)(level);
-    const auto& idx = m_sim.repo().mesh().Geom(level).InvCellSizeArray();
+    const auto& grad = m_sim.velocity_gradient()(level, FieldState::New);
 
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
-    for (amrex::MFIter mfi(mfab, amrex::TilingIfNotGPU()); mfi.isValid();
+    for (amrex::MFIter mfi(grad, amrex::TilingIfNotGPU()); mfi.isValid();
          ++mfi) {
         const auto& bx = mfi.tilebox();
         const auto& tag = tags.array(mfi);
-        const auto& vel = mfab.const_array(mfi);
+        const auto& garr = grad.const_array(mfi);
         const auto vort_val = m_vort_value[level];
 
         amrex::ParallelFor(
             bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                // TODO: ignoring wall stencils for now
-                const auto vx =
-                    0.5 * (vel(i + 1, j, k, 1) - vel(i - 1, j, k, 1)) * idx[0];
-                const auto wx =
-                    0.5 * (vel(i + 1, j, k, 2) - vel(i - 1, j, k, 2)) * idx[0];
-
-                const auto uy =
-                    0.5 * (vel(i, j + 1, k, 0) - vel(i, j - 1, k, 0)) * idx[1];
-                const auto wy =
-                    0.5 * (vel(i, j + 1, k, 2) - vel(i, j - 1, k, 2)) * idx[1];
-
-                const auto uz =
-                    0.5 * (vel(i, j, k + 1, 0) - vel(i, j, k - 1, 0)) * idx[2];
-                const auto vz =
-                    0.5 * (vel(i, j, k + 1, 1) - vel(i, j, k - 1, 1)) * idx[2];
-
-                const auto vort = sqrt(
-                    std::pow(uy - vx, 2) + std::pow(vz - wy, 2) +
-                    std::pow(wx - uz, 2));
+                const auto vort =
+                    VelocityGradient::vorticity_mag(garr, i, j, k);
 
                 if (vort > vort_val) {
                     tag(i, j, k) = amrex::TagBox::SET;
@@ -5,6 +5,9 @@
 #include "AMReX_ParmParse.H"
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 #include <AMReX_PlotFileUtil.H>
+#include <AMReX_VisMF.H>
+
+#include <stdexcept>
 
 namespace amr_wind {
 
@@ -65,6 +68,38 @@ AMREX_FORCE_INLINE std::string level_name(int lev)
 }
 #endif
 
+/** Read the single FAB of a boundary face file into host memory
+ *
+ *  Unlike VisMF::readFAB, the data is read into the arena of `fab` and no
+ *  shared VisMF stream is used, so this can run on a helper thread. Errors
+ *  are reported with exceptions for the caller thread to handle.
+ */
+void read_host_fab(
+    const std::string& facename,
+    const amrex::VisMF::Header& hdr,
+    amrex::FArrayBox& fab)
+{
+    const auto& fod = hdr.m_fod[0];
+    const std::string fullname = amrex::VisMF::DirName(facename) + fod.m_name;
+    std::ifstream ifs(fullname, std::ios::in | std::ios::binary);
+    if (!ifs.good()) {
+        throw std::runtime_error("Cannot open boundary file: " + fullname);
+    }
+    ifs.seekg(fod.m_head, std::ios::beg);
+
+    if (amrex::VisMF::NoFabHeader(hdr)) {
+        fab.resize(amrex::grow(hdr.m_ba[0], hdr.m_ngrow), hdr.m_ncomp);
+        amrex::RealDescriptor::convertToNativeFormat(
+            fab.dataPtr(), fab.size(), ifs, hdr.m_writtenRD);
+    } else {
+        fab.readFrom(ifs);
+    }
+
+    if (ifs.fail()) {
+        throw std::runtime_error("Error reading boundary file: " + fullname);
+    }
+}
+
 } // namespace
 
 void InletData::resize(const int size)
@@ -72,6 +107,7 @@ void InletData::resize(const int size)
     m_data_n.resize(size);
     m_data_np1.resize(size);
     m_data_interp.resize(size);
+    m_data_stage.resize(size);
 }
 
 void InletData::define_plane(const amrex::Orientation ori)
@@ -79,6 +115,9 @@ void InletData::define_plane(const amrex::Orientation ori)
     m_data_n[ori] = std::make_unique<PlaneVector>();
     m_data_np1[ori] = std::make_unique<PlaneVector>();
     m_data_interp[ori] = std::make_unique<PlaneVector>();
+    if (m_use_stage) {
+        m_data_stage[ori] = std::make_unique<PlaneVector>();
+    }
 }
 
 void InletData::define_level_data(
@@ -90,6 +129,13 @@ void InletData::define_level_data(
     m_data_n[ori]->push_back(amrex::FArrayBox(bx, static_cast<int>(nc)));
     m_data_np1[ori]->push_back(amrex::FArrayBox(bx, static_cast<int>(nc)));
     m_data_interp[ori]->push_back(amrex::FArrayBox(bx, static_cast<int>(nc)));
+    if (m_use_stage) {
+        // Staging buffers are filled on the host by the prefetch thread. Only
+        // the faces touching local boxes are read, zero the rest
+        m_data_stage[ori]->push_back(amrex::FArrayBox(
+            bx, static_cast<int>(nc), amrex::The_Pinned_Arena()));
+        m_data_stage[ori]->back().setVal<amrex::RunOn::Host>(0.0);
+    }
 }
 
 #ifdef AMR_WIND_USE_NETCDF
@@ -228,6 +274,72 @@ void InletData::read_data_native(
     bndry.copyTo((*m_data_np1[ori])[lev], 0, nstart, static_cast<int>(nc));
 }
 
+/** Average a boundary register face read from disk into the staging buffer
+ *
+ *  This is the host-only counterpart of InletData::read_data_native and does
+ *  not perform any communication so that it can run on a helper thread.
+ *  Errors are reported with exceptions.
+ */
+void InletData::read_stage_native(
+    const amrex::Orientation ori,
+    const amrex::FArrayBox& bndry,
+    const int lev,
+    const Field* fld)
+{
+    const int nc = fld->num_comp();
+    const int nstart = m_components[static_cast<int>(fld->id())];
+    if (bndry.nComp() != nc) {
+        throw std::runtime_error(
+            "Inconsistent number of components in boundary file for " +
+            fld->name());
+    }
+
+    auto& stage = (*m_data_stage[ori])[lev];
+    const amrex::IntVect v_offset = offset(ori.faceDir(), ori.coordDir());
+    const auto& bx = stage.box() & bndry.box();
+    if (bx.isEmpty()) {
+        return;
+    }
+
+    const auto& bndry_arr = bndry.const_array();
+    const auto& stage_arr = stage.array();
+    amrex::LoopOnCpu(bx, nc, [=](int i, int j, int k, int n) noexcept {
+        stage_arr(i, j, k, n + nstart) =
+            0.5 * (bndry_arr(i, j, k, n) +
+                   bndry_arr(
+                       i + v_offset[0], j + v_offset[1], k + v_offset[2], n));
+    });
+}
+
+/** Advance the time bracket by one input time using the staged plane
+ *
+ *  The buffers at n and n + 1 are swapped so that the old n + 1 data becomes
+ *  the new n data without copies, and the staged plane is copied into n + 1.
+ */
+void InletData::advance_from_stage(const amrex::Real tn, const amrex::Real tnp1)
+{
+    AMREX_ALWAYS_ASSERT(m_use_stage);
+    m_tn = tn;
+    m_tnp1 = tnp1;
+    for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+        auto ori = oit();
+        if (!this->is_populated(ori)) {
+            continue;
+        }
+
+        std::swap(m_data_n[ori], m_data_np1[ori]);
+        const int lnlevels = static_cast<int>(m_data_np1[ori]->size());
+        for (int lev = 0; lev < lnlevels; ++lev) {
+            auto& datnp1 = (*m_data_np1[ori])[lev];
+            const auto& stage = (*m_data_stage[ori])[lev];
+            datnp1.copy<amrex::RunOn::Device>(stage);
+        }
+    }
+
+    // The staging buffers are refilled by the next prefetch
+    amrex::Gpu::streamSynchronize();
+}
+
 void InletData::interpolate(const amrex::Real time)
 {
     m_tinterp = time;
@@ -282,6 +394,7 @@ ABLBoundaryPlane::ABLBoundaryPlane(CFDSim& sim)
     pp.queryarr("bndry_var_names", m_var_names);
     pp.get("bndry_file", m_filename);
     pp.query("bndry_output_format", m_out_fmt);
+    pp.query("bndry_prefetch", m_prefetch);
 
 #ifndef AMR_WIND_USE_NETCDF
     if (m_out_fmt == "netcdf") {
@@ -302,6 +415,25 @@ ABLBoundaryPlane::ABLBoundaryPlane(CFDSim& sim)
 
     // only used for native format
     m_time_file = m_filename + "/time.dat";
+
+    if (m_prefetch && (m_io_mode == io_mode::input)) {
+        if (m_out_fmt == "native") {
+            m_in_data.enable_staging();
+        } else {
+            amrex::Print() << "Warning: boundary plane prefetch is only "
+                              "available for the native format, disabling"
+                           << std::endl;
+            m_prefetch = false;
+        }
+    }
+}
+
+ABLBoundaryPlane::~ABLBoundaryPlane()
+{
+    // Make sure the helper thread is not writing into the staging buffers
+    if (m_prefetch_result.valid()) {
+        m_prefetch_result.wait();
+    }
 }
 
 void ABLBoundaryPlane::post_init_actions()
@@ -800,6 +932,13 @@ void ABLBoundaryPlane::read_file()
 
 #endif
 
+    if ((m_out_fmt == "native") &&
+        use_prefetched_data(closest_index(m_in_times, time))) {
+        m_in_data.interpolate(time);
+        launch_prefetch(closest_index(m_in_times, time) + 2);
+        return;
+    }
+
     if (m_out_fmt == "native") {
 
         const int index = closest_index(m_in_times, time);
@@ -863,11 +1002,144 @@ void ABLBoundaryPlane::read_file()
                 }
             }
         }
+
+        launch_prefetch(index + 2);
     }
 
     m_in_data.interpolate(time);
 }
 
+/** Collect the face files of the native boundary plane at input time index
+ *  ``idx`` that are needed on this rank
+ *
+ *  Headers are read here, on the main thread, so that missing files abort
+ *  before the helper thread is started. Faces that do not touch the boxes
+ *  owned by this rank are skipped.
+ */
+amrex::Vector<ABLBoundaryPlane::PrefetchFace>
+ABLBoundaryPlane::prefetch_faces(const int idx)
+{
+    const std::string chkname =
+        m_filename + amrex::Concatenate("/bndry_output", m_in_timesteps[idx]);
+    const std::string level_prefix = "Level_";
+
+    amrex::Vector<PrefetchFace> faces;
+    const int nlevels = boundary_native_file_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& ba = m_mesh.boxArray(lev);
+        const auto& dm = m_mesh.DistributionMap(lev);
+        const int myproc = amrex::ParallelDescriptor::MyProc();
+
+        for (auto* fld : m_fields) {
+            const std::string filename = amrex::MultiFabFileFullPrefix(
+                lev, chkname, level_prefix, fld->name());
+            const int ngrow = fld->num_grow().max() + 1;
+
+            for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+                auto ori = oit();
+
+                if ((!m_in_data.is_populated(ori)) ||
+                    (fld->bc_type()[ori] != BC::mass_inflow)) {
+                    continue;
+                }
+
+                const auto& pbx = m_in_data.interpolate_data(ori, lev).box();
+                bool is_local = false;
+                for (int i = 0; (i < ba.size()) && !is_local; ++i) {
+                    is_local = (dm[i] == myproc) &&
+                               amrex::grow(ba[i], ngrow).intersects(pbx);
+                }
+                if (!is_local) {
+                    continue;
+                }
+
+                PrefetchFace face{
+                    ori, lev, fld, amrex::Concatenate(filename + '_', ori, 1),
+                    amrex::VisMF::Header()};
+                std::ifstream ifs(face.facename + "_H");
+                if (!ifs.good()) {
+                    amrex::Abort("Cannot find boundary file: " + face.facename);
+                }
+                ifs >> face.hdr;
+
+                // Boundary files are written with a single box per face
+                AMREX_ALWAYS_ASSERT(face.hdr.m_ba.size() == 1);
+                AMREX_ALWAYS_ASSERT(face.hdr.m_ncomp == fld->num_comp());
+                faces.push_back(std::move(face));
+            }
+        }
+    }
+    return faces;
+}
+
+/** Read the boundary faces into the staging buffers
+ *
+ *  The data is read into host memory and averaged on the host without any
+ *  MPI communication, so that this can run on a helper thread.
+ */
+void ABLBoundaryPlane::prefetch_native_data(
+    const amrex::Vector<PrefetchFace>& faces)
+{
+    amrex::FArrayBox fab(amrex::The_Pinned_Arena());
+    for (const auto& face : faces) {
+        read_host_fab(face.facename, face.hdr, fab);
+        m_in_data.read_stage_native(face.ori, fab, face.lev, face.fld);
+    }
+}
+
+//! Start reading the plane at input time index ``idx`` on a helper thread
+void ABLBoundaryPlane::launch_prefetch(const int idx)
+{
+    if (!m_prefetch || (idx >= static_cast<int>(m_in_times.size()))) {
+        return;
+    }
+
+    if (m_prefetch_result.valid()) {
+        m_prefetch_result.wait();
+    }
+
+    m_prefetch_idx = idx;
+    m_prefetch_result = std::async(
+        std::launch::async, [this, faces = prefetch_faces(idx)] {
+            prefetch_native_data(faces);
+        });
+}
+
+/** Advance the inflow data using the prefetched plane if possible
+ *
+ *  \return True if the time bracket starting at ``idx`` was populated from
+ *  the staging buffers
+ */
+bool ABLBoundaryPlane::use_prefetched_data(const int idx)
+{
+    if (!m_prefetch || !m_prefetch_result.valid()) {
+        return false;
+    }
+
+    // Wait for the read to complete, the staging buffers are reused
+    // regardless of whether the plane is the one required now
+    {
+        BL_PROFILE("amr-wind::ABLBoundaryPlane::prefetch_wait");
+        try {
+            m_prefetch_result.get();
+        } catch (const std::exception& err) {
+            amrex::Abort(
+                std::string("ABLBoundaryPlane: prefetch failed: ") +
+                err.what());
+        }
+    }
+
+    const bool is_next_bracket =
+        ((idx + 1) == m_prefetch_idx) &&
+        (std::abs(m_in_data.tnp1() - m_in_times[idx]) < 1.0e-12);
+    if (!is_next_bracket) {
+        return false;
+    }
+
+    m_in_data.advance_from_stage(m_in_times[idx], m_in_times[idx + 1]);
+    return true;
+}
+
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
 void ABLBoundaryPlane::populate_data(
     const int lev,
@@ -1,4 +1,5 @@
 #include "amr-wind/wind_energy/ABLStats.H"
+#include "amr-wind/core/VelocityGradient.H"
 #include "amr-wind/fvm/gradient.H"
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 #include "amr-wind/utilities/io_utils.H"
@@ -34,6 +35,7 @@ ABLStats::ABLStats(
     , m_pa_tu(m_pa_vel, m_pa_temp)
     , m_pa_uu(m_pa_vel, m_pa_vel)
     , m_pa_uuu(m_pa_vel, m_pa_vel, m_pa_vel)
+    , m_pa_fused(dir)
 {}
 
 ABLStats::~ABLStats() = default;
@@ -83,6 +85,14 @@ void ABLStats::initialize()
     }
     m_dn = geom.CellSize()[m_normal_dir];
 
+    m_pa_fused.add(m_pa_vel);
+    m_pa_fused.add(m_pa_temp);
+    m_pa_fused.add(m_pa_mueff);
+    m_pa_fused.add(m_pa_tt);
+    m_pa_fused.add(m_pa_tu);
+    m_pa_fused.add(m_pa_uu);
+    m_pa_fused.add(m_pa_uuu);
+
     if (m_out_fmt == "netcdf") {
         prepare_netcdf_file();
     } else {
@@ -90,13 +100,11 @@ void ABLStats::initialize()
     }
 }
 
-void ABLStats::calc_averages()
+void ABLStats::calc_averages(bool include_moments)
 {
-    m_pa_vel();
-    m_pa_temp();
+    m_pa_fused(include_moments);
     m_pa_vel_fine();
     m_pa_temp_fine();
-    m_pa_mueff();
 }
 
 //! Calculate sfs stress averages
@@ -108,9 +116,7 @@ void ABLStats::calc_sfs_stress_avgs(
 
     const auto& repo = m_sim.repo();
 
-    const auto& m_vel = repo.get_field("velocity");
-    auto gradVel = repo.create_scratch_field(9);
-    fvm::gradient(*gradVel, m_vel);
+    auto& vel_grad = m_sim.velocity_gradient();
 
     const auto& alphaeff = repo.get_field(pde_impl::mueff_name("temperature"));
     auto gradT = repo.create_scratch_field(3);
@@ -118,11 +124,12 @@ void ABLStats::calc_sfs_stress_avgs(
 
     const int nlevels = repo.num_active_levels();
     for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& gradVel = vel_grad(lev, FieldState::New);
         for (amrex::MFIter mfi(m_mueff(lev)); mfi.isValid(); ++mfi) {
             const auto& bx = mfi.tilebox();
             const auto& mueff_arr = m_mueff(lev).array(mfi);
             const auto& alphaeff_arr = alphaeff(lev).array(mfi);
-            const auto& gradVel_arr = (*gradVel)(lev).array(mfi);
+            const auto& gradVel_arr = gradVel.const_array(mfi);
             const auto& gradT_arr = (*gradT)(lev).array(mfi);
             const auto& sfs_arr = sfs_stress(lev).array(mfi);
             const auto& t_sfs_arr = t_sfs_stress(lev).array(mfi);
@@ -210,23 +217,21 @@ void ABLStats::post_advance_work()
 {
     BL_PROFILE("amr-wind::ABLStats::post_advance_work");
 
-    // Always compute mean velocity/temperature profiles
-    calc_averages();
-
     const auto& time = m_sim.time();
     const int tidx = time.time_index();
+    const bool is_output_step = (tidx % m_out_freq == 0);
+
+    // Always compute mean velocity/temperature profiles, the moments are
+    // computed in the same pass on output steps
+    calc_averages(is_output_step);
+
     // Skip processing if it is not an output timestep
-    if (!(tidx % m_out_freq == 0)) {
+    if (!is_output_step) {
         return;
     }
 
     compute_zi();
 
-    m_pa_tt();
-    m_pa_tu();
-    m_pa_uu();
-    m_pa_uuu();
-
     process_output();
 }
 
@@ -88,6 +88,8 @@ ABLWallFunction::ABLWallFunction(const CFDSim& sim)
     m_mo.alg_type = m_tempflux ? MOData::ThetaCalcType::HEAT_FLUX
                                : MOData::ThetaCalcType::SURFACE_TEMPERATURE;
     m_mo.gravity = utils::vec_mag(m_gravity.data());
+
+    m_local_mo.read_inputs("ABL", m_mo);
 }
 
 void ABLWallFunction::init_log_law_height()
@@ -148,7 +150,8 @@ ABLVelWallFunc::ABLVelWallFunc(
         m_wall_shear_stress_type == "local" ||
         m_wall_shear_stress_type == "schumann" ||
         m_wall_shear_stress_type == "donelan" ||
-        m_wall_shear_stress_type == "moeng") {
+        m_wall_shear_stress_type == "moeng" ||
+        m_wall_shear_stress_type == "local_mo") {
         amrex::Print() << "Shear Stress model: " << m_wall_shear_stress_type
                        << std::endl;
     } else {
@@ -243,11 +246,120 @@ void ABLVelWallFunc::wall_model(
     }
 }
 
+void ABLVelWallFunc::local_mo_wall_model(
+    Field& velocity, const FieldState rho_state)
+{
+    BL_PROFILE("amr-wind::ABLVelWallFunc::local_mo");
+
+    constexpr int idim = 2;
+    constexpr amrex::Real small_vel = 1.0e-6;
+    const auto& repo = velocity.repo();
+    const auto& density = repo.get_field("density", rho_state);
+    const auto& viscosity = repo.get_field("velocity_mueff");
+    const auto& temperature =
+        repo.get_field("temperature").state(FieldState::Old);
+    const int nlevels = repo.num_active_levels();
+    const auto mo = m_wall_func.local_mo().view(m_wall_func.mo());
+
+    amrex::Orientation zlo(amrex::Direction::z, amrex::Orientation::low);
+    amrex::Orientation zhi(amrex::Direction::z, amrex::Orientation::high);
+    if ((velocity.bc_type()[zlo] != BC::wall_model) &&
+        (velocity.bc_type()[zhi] != BC::wall_model)) {
+        return;
+    }
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& geom = repo.mesh().Geom(lev);
+        const auto& domain = geom.Domain();
+        const auto& problo = geom.ProbLoArray();
+        const auto& dx = geom.CellSizeArray();
+        const amrex::Real zref = 0.5 * dx[idim];
+        amrex::MFItInfo mfi_info{};
+
+        const auto& rho_lev = density(lev);
+        auto& vold_lev = velocity.state(FieldState::Old)(lev);
+        auto& vel_lev = velocity(lev);
+        const auto& eta_lev = viscosity(lev);
+        const auto& told_lev = temperature(lev);
+
+        if (amrex::Gpu::notInLaunchRegion()) {
+            mfi_info.SetDynamic(true);
+        }
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (amrex::MFIter mfi(vel_lev, mfi_info); mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.validbox();
+            auto varr = vel_lev.array(mfi);
+            auto vold_arr = vold_lev.const_array(mfi);
+            auto told_arr = told_lev.const_array(mfi);
+            auto den = rho_lev.const_array(mfi);
+            auto eta = eta_lev.const_array(mfi);
+
+            if (bx.smallEnd(idim) == domain.smallEnd(idim) &&
+                velocity.bc_type()[zlo] == BC::wall_model) {
+                amrex::ParallelFor(
+                    amrex::bdryLo(bx, idim),
+                    [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                        const amrex::Real mu = eta(i, j, k);
+                        const amrex::Real uu = vold_arr(i, j, k, 0);
+                        const amrex::Real vv = vold_arr(i, j, k, 1);
+                        const amrex::Real wspd = std::sqrt(uu * uu + vv * vv);
+                        const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+                        const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                        const auto flux =
+                            mo.solve(x, y, zref, wspd, told_arr(i, j, k));
+                        const amrex::Real fac =
+                            flux.utau * flux.utau * den(i, j, k) /
+                            (amrex::max(wspd, small_vel) * mu);
+
+                        // Dirichlet BC
+                        varr(i, j, k - 1, 2) = 0.0;
+
+                        // Shear stress BC
+                        varr(i, j, k - 1, 0) = uu * fac;
+                        varr(i, j, k - 1, 1) = vv * fac;
+                    });
+            }
+
+            if (bx.bigEnd(idim) == domain.bigEnd(idim) &&
+                velocity.bc_type()[zhi] == BC::wall_model) {
+                amrex::ParallelFor(
+                    amrex::bdryHi(bx, idim),
+                    [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                        const amrex::Real mu = eta(i, j, k - 1);
+                        const amrex::Real uu = vold_arr(i, j, k - 1, 0);
+                        const amrex::Real vv = vold_arr(i, j, k - 1, 1);
+                        const amrex::Real wspd = std::sqrt(uu * uu + vv * vv);
+                        const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+                        const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                        const auto flux =
+                            mo.solve(x, y, zref, wspd, told_arr(i, j, k - 1));
+                        const amrex::Real fac =
+                            flux.utau * flux.utau * den(i, j, k - 1) /
+                            (amrex::max(wspd, small_vel) * mu);
+
+                        // Dirichlet BC
+                        varr(i, j, k, 2) = 0.0;
+
+                        // Shear stress BC
+                        varr(i, j, k, 0) = -uu * fac;
+                        varr(i, j, k, 1) = -vv * fac;
+                    });
+            }
+        }
+    }
+}
+
 void ABLVelWallFunc::operator()(Field& velocity, const FieldState rho_state)
 {
     const auto& mo = m_wall_func.mo();
 
-    if (m_wall_shear_stress_type == "moeng") {
+    if (m_wall_shear_stress_type == "local_mo") {
+
+        local_mo_wall_model(velocity, rho_state);
+
+    } else if (m_wall_shear_stress_type == "moeng") {
 
         auto tau = ShearStressMoeng(mo);
         wall_model(velocity, rho_state, tau);
@@ -367,12 +479,103 @@ void ABLTempWallFunc::wall_model(
     }
 }
 
+void ABLTempWallFunc::local_mo_wall_model(
+    Field& temperature, const FieldState rho_state)
+{
+    constexpr int idim = 2;
+    auto& repo = temperature.repo();
+
+    amrex::Orientation zlo(amrex::Direction::z, amrex::Orientation::low);
+    amrex::Orientation zhi(amrex::Direction::z, amrex::Orientation::high);
+    if ((temperature.bc_type()[zlo] != BC::wall_model) &&
+        (temperature.bc_type()[zhi] != BC::wall_model)) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::ABLTempWallFunc::local_mo");
+    auto& velocity = repo.get_field("velocity");
+    const auto& density = repo.get_field("density", rho_state);
+    const auto& alpha = repo.get_field("temperature_mueff");
+    const int nlevels = repo.num_active_levels();
+    const auto mo = m_wall_func.local_mo().view(m_wall_func.mo());
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& geom = repo.mesh().Geom(lev);
+        const auto& domain = geom.Domain();
+        const auto& problo = geom.ProbLoArray();
+        const auto& dx = geom.CellSizeArray();
+        const amrex::Real zref = 0.5 * dx[idim];
+        amrex::MFItInfo mfi_info{};
+
+        const auto& rho_lev = density(lev);
+        auto& vold_lev = velocity.state(FieldState::Old)(lev);
+        auto& told_lev = temperature.state(FieldState::Old)(lev);
+        auto& theta = temperature(lev);
+        const auto& eta_lev = alpha(lev);
+
+        if (amrex::Gpu::notInLaunchRegion()) {
+            mfi_info.SetDynamic(true);
+        }
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (amrex::MFIter mfi(theta, mfi_info); mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.validbox();
+            auto vold_arr = vold_lev.const_array(mfi);
+            auto told_arr = told_lev.const_array(mfi);
+            auto tarr = theta.array(mfi);
+            auto den = rho_lev.const_array(mfi);
+            auto eta = eta_lev.const_array(mfi);
+
+            if (bx.smallEnd(idim) == domain.smallEnd(idim) &&
+                temperature.bc_type()[zlo] == BC::wall_model) {
+                amrex::ParallelFor(
+                    amrex::bdryLo(bx, idim),
+                    [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                        const amrex::Real alphaT = eta(i, j, k);
+                        const amrex::Real uu = vold_arr(i, j, k, 0);
+                        const amrex::Real vv = vold_arr(i, j, k, 1);
+                        const amrex::Real wspd = std::sqrt(uu * uu + vv * vv);
+                        const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+                        const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                        const auto flux =
+                            mo.solve(x, y, zref, wspd, told_arr(i, j, k));
+                        tarr(i, j, k - 1) =
+                            -den(i, j, k) * flux.surf_temp_flux / alphaT;
+                    });
+            }
+
+            if (bx.bigEnd(idim) == domain.bigEnd(idim) &&
+                temperature.bc_type()[zhi] == BC::wall_model) {
+                amrex::ParallelFor(
+                    amrex::bdryHi(bx, idim),
+                    [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                        const amrex::Real alphaT = eta(i, j, k - 1);
+                        const amrex::Real uu = vold_arr(i, j, k - 1, 0);
+                        const amrex::Real vv = vold_arr(i, j, k - 1, 1);
+                        const amrex::Real wspd = std::sqrt(uu * uu + vv * vv);
+                        const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+                        const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                        const auto flux =
+                            mo.solve(x, y, zref, wspd, told_arr(i, j, k - 1));
+                        tarr(i, j, k) =
+                            den(i, j, k - 1) * flux.surf_temp_flux / alphaT;
+                    });
+            }
+        }
+    }
+}
+
 void ABLTempWallFunc::operator()(Field& temperature, const FieldState rho_state)
 {
 
     const auto& mo = m_wall_func.mo();
 
-    if (m_wall_shear_stress_type == "moeng") {
+    if (m_wall_shear_stress_type == "local_mo") {
+
+        local_mo_wall_model(temperature, rho_state);
+
+    } else if (m_wall_shear_stress_type == "moeng") {
 
         auto tau = ShearStressMoeng(mo);
         wall_model(temperature, rho_state, tau);
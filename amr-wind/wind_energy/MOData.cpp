@@ -1,5 +1,6 @@
 #include <limits>
 #include "amr-wind/wind_energy/MOData.H"
+#include "amr-wind/wind_energy/MOSurfaceLayer.H"
 
 namespace amr_wind {
 
@@ -16,21 +17,12 @@ namespace amr_wind {
 
 amrex::Real MOData::calc_psi_m(amrex::Real zeta) const
 {
-    if (zeta > 0) {
-        return -gamma_m * zeta;
-    }
-    amrex::Real x = std::sqrt(std::sqrt(1 - beta_m * zeta));
-    return 2.0 * std::log(0.5 * (1.0 + x)) + log(0.5 * (1 + x * x)) -
-           2.0 * std::atan(x) + utils::half_pi();
+    return mo::psi_m_dyer(zeta, gamma_m, beta_m);
 }
 
 amrex::Real MOData::calc_psi_h(amrex::Real zeta) const
 {
-    if (zeta > 0) {
-        return -gamma_h * zeta;
-    }
-    amrex::Real x = std::sqrt(1 - beta_h * zeta);
-    return 2.0 * std::log(0.5 * (1 + x));
+    return mo::psi_h_dyer(zeta, gamma_h, beta_h);
 }
 
 void MOData::update_fluxes(int max_iters)
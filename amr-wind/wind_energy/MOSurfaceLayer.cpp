@@ -0,0 +1,138 @@
+#include "amr-wind/wind_energy/MOSurfaceLayer.H"
+
+#include "AMReX_ParmParse.H"
+#include "AMReX_Print.H"
+
+namespace amr_wind {
+
+void MOSurfaceLayer::read_inputs(const std::string& pp_prefix, const MOData& mo)
+{
+    amrex::ParmParse pp(pp_prefix);
+    pp.query("mo_num_iterations", m_num_iters);
+    pp.query("mo_zeta_min", m_zeta_min);
+    pp.query("mo_zeta_max", m_zeta_max);
+    pp.query("mo_lookup_table", m_use_table);
+    pp.query("mo_lookup_table_size", m_table_size);
+    AMREX_ALWAYS_ASSERT(m_num_iters > 0);
+    AMREX_ALWAYS_ASSERT((m_zeta_min < 0.0) && (m_zeta_max > 0.0));
+    AMREX_ALWAYS_ASSERT(m_table_size > 1);
+
+    amrex::Vector<std::string> patches;
+    pp.queryarr("surface_patches", patches);
+
+    const int npatches = static_cast<int>(patches.size());
+    amrex::Vector<amrex::Real> bounds(4 * npatches);
+    amrex::Vector<int> mask(npatches, 0);
+    amrex::Vector<amrex::Real> z0(npatches, mo.z0);
+    amrex::Vector<amrex::Real> temp(npatches, 0.0);
+    amrex::Vector<amrex::Real> flux(npatches, 0.0);
+    for (int ip = 0; ip < npatches; ++ip) {
+        amrex::ParmParse ppp(pp_prefix + ".surface_patch." + patches[ip]);
+        amrex::Vector<amrex::Real> lo, hi;
+        ppp.getarr("lo", lo);
+        ppp.getarr("hi", hi);
+        AMREX_ALWAYS_ASSERT((lo.size() == 2) && (hi.size() == 2));
+        bounds[4 * ip + 0] = lo[0];
+        bounds[4 * ip + 1] = lo[1];
+        bounds[4 * ip + 2] = hi[0];
+        bounds[4 * ip + 3] = hi[1];
+
+        if (ppp.query("surface_roughness_z0", z0[ip]) != 0) {
+            mask[ip] |= 1;
+        }
+        if (ppp.query("surface_temp", temp[ip]) != 0) {
+            mask[ip] |= 2;
+        }
+        if (ppp.query("surface_temp_flux", flux[ip]) != 0) {
+            mask[ip] |= 4;
+        }
+        AMREX_ALWAYS_ASSERT(z0[ip] > 0.0);
+    }
+
+    m_patch_bounds.resize(bounds.size());
+    m_patch_mask.resize(mask.size());
+    m_patch_z0.resize(z0.size());
+    m_patch_temp.resize(temp.size());
+    m_patch_flux.resize(flux.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, bounds.begin(), bounds.end(),
+        m_patch_bounds.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, mask.begin(), mask.end(),
+        m_patch_mask.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, z0.begin(), z0.end(), m_patch_z0.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, temp.begin(), temp.end(),
+        m_patch_temp.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, flux.begin(), flux.end(),
+        m_patch_flux.begin());
+
+    if (m_use_table) {
+        build_tables(mo);
+    }
+
+    if (npatches > 0) {
+        amrex::Print() << "MOSurfaceLayer: " << npatches
+                       << " surface patch(es) defined" << std::endl;
+    }
+}
+
+void MOSurfaceLayer::build_tables(const MOData& mo)
+{
+    amrex::Vector<amrex::Real> psi_m(m_table_size);
+    amrex::Vector<amrex::Real> psi_h(m_table_size);
+    const amrex::Real dzeta = -m_zeta_min / (m_table_size - 1);
+    for (int i = 0; i < m_table_size; ++i) {
+        const amrex::Real zeta = m_zeta_min + i * dzeta;
+        psi_m[i] = mo::psi_m_dyer(zeta, mo.gamma_m, mo.beta_m);
+        psi_h[i] = mo::psi_h_dyer(zeta, mo.gamma_h, mo.beta_h);
+    }
+
+    m_psi_m_tab.resize(m_table_size);
+    m_psi_h_tab.resize(m_table_size);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, psi_m.begin(), psi_m.end(),
+        m_psi_m_tab.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, psi_h.begin(), psi_h.end(),
+        m_psi_h_tab.begin());
+}
+
+MOSurfaceLayerView MOSurfaceLayer::view(const MOData& mo) const
+{
+    MOSurfaceLayerView v;
+    v.kappa = mo.kappa;
+    v.gravity = mo.gravity;
+    v.gamma_m = mo.gamma_m;
+    v.gamma_h = mo.gamma_h;
+    v.beta_m = mo.beta_m;
+    v.beta_h = mo.beta_h;
+    v.zeta_min = m_zeta_min;
+    v.zeta_max = m_zeta_max;
+
+    if (m_use_table) {
+        v.psi_m_tab = m_psi_m_tab.data();
+        v.psi_h_tab = m_psi_h_tab.data();
+        v.ntab = m_table_size;
+        v.dzeta_inv = (m_table_size - 1) / (-m_zeta_min);
+    }
+
+    v.z0 = mo.z0;
+    v.surf_temp = mo.surf_temp;
+    v.surf_temp_flux = mo.surf_temp_flux;
+    v.alg_type = mo.alg_type;
+
+    v.npatches = num_patches();
+    v.patch_bounds = m_patch_bounds.data();
+    v.patch_mask = m_patch_mask.data();
+    v.patch_z0 = m_patch_z0.data();
+    v.patch_temp = m_patch_temp.data();
+    v.patch_flux = m_patch_flux.data();
+
+    v.num_iters = m_num_iters;
+    return v;
+}
+
+} // namespace amr_wind
@@ -4,6 +4,7 @@
 #include "amr-wind/wind_energy/actuator/ActuatorContainer.H"
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/core/FieldRepo.H"
+#include "amr-wind/utilities/PerfReport.H"
 
 #include <algorithm>
 #include <memory>
@@ -23,6 +24,9 @@ void Actuator::pre_init_actions()
 
     amrex::Vector<std::string> labels;
     pp.getarr("labels", labels);
+    pp.query("verbose", m_verbose);
+    pp.query("sparse_gather", m_sparse_gather);
+    pp.query("load_balance_weight", m_load_balance_weight);
 
     const int nturbines = static_cast<int>(labels.size());
 
@@ -93,6 +97,7 @@ void Actuator::post_regrid_actions()
 void Actuator::pre_advance_work()
 {
     BL_PROFILE("amr-wind::actuator::Actuator::pre_advance_work");
+    perf::ScopedTimer perf_timer(perf::Region::actuator);
 
     m_container->reset_container();
     update_positions();
@@ -102,6 +107,52 @@ void Actuator::pre_advance_work()
     communicate_turbine_io();
 }
 
+void Actuator::add_load_balance_cost(int lev, amrex::MultiFab& cost) const
+{
+    if (m_actuators.empty() || (m_load_balance_weight <= 0.0)) {
+        return;
+    }
+
+    // Bounding boxes stored as (xlo, ylo, zlo, xhi, yhi, zhi)
+    const int nact = num_actuators();
+    amrex::Vector<amrex::Real> bounds(6 * nact);
+    for (int ia = 0; ia < nact; ++ia) {
+        const auto& bbox = m_actuators[ia]->info().bound_box;
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            bounds[6 * ia + d] = bbox.lo(d);
+            bounds[6 * ia + 3 + d] = bbox.hi(d);
+        }
+    }
+    amrex::Gpu::DeviceVector<amrex::Real> bounds_d(bounds.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, bounds.begin(), bounds.end(),
+        bounds_d.begin());
+
+    const auto& geom = m_sim.mesh().Geom(lev);
+    const auto problo = geom.ProbLoArray();
+    const auto dx = geom.CellSizeArray();
+    const auto* bb = bounds_d.data();
+    const amrex::Real weight = m_load_balance_weight;
+    for (amrex::MFIter mfi(cost); mfi.isValid(); ++mfi) {
+        const auto& bx = mfi.validbox();
+        const auto& carr = cost.array(mfi);
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+            const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+            const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+            for (int ia = 0; ia < nact; ++ia) {
+                const amrex::Real* b = &bb[6 * ia];
+                if ((x >= b[0]) && (x <= b[3]) && (y >= b[1]) &&
+                    (y <= b[4]) && (z >= b[2]) && (z <= b[5])) {
+                    carr(i, j, k) += weight;
+                    break;
+                }
+            }
+        });
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
 void Actuator::communicate_turbine_io()
 {
 #ifdef AMR_WIND_USE_HELICS
@@ -151,6 +202,7 @@ void Actuator::setup_container()
         }));
 
     m_container = std::make_unique<ActuatorContainer>(m_sim.mesh(), nlocal);
+    m_container->use_sparse_gather(m_sparse_gather);
 
     auto& pinfo = m_container->m_data;
     for (int i = 0, il = 0; i < ntotal; ++i) {
@@ -218,6 +270,11 @@ void Actuator::update_velocities()
 void Actuator::compute_forces()
 {
     BL_PROFILE("amr-wind::actuator::Actuator::compute_forces");
+    for (auto& ac : m_actuators) {
+        if (ac->info().actuator_in_proc) {
+            ac->begin_compute_forces();
+        }
+    }
     for (auto& ac : m_actuators) {
         if (ac->info().actuator_in_proc) {
             ac->compute_forces();
@@ -246,6 +303,18 @@ void Actuator::compute_source_term()
             }
         }
     }
+
+    if (m_verbose > 0) {
+        amrex::Long nskipped = 0;
+        for (auto& ac : m_actuators) {
+            if (ac->info().actuator_in_proc) {
+                nskipped += ac->num_skipped_source_evals();
+            }
+        }
+        amrex::ParallelDescriptor::ReduceLongSum(nskipped);
+        amrex::Print() << "Actuator: skipped " << nskipped
+                       << " point-cell source term evaluations" << std::endl;
+    }
 }
 
 void Actuator::prepare_outputs()
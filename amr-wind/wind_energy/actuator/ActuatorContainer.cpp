@@ -7,6 +7,7 @@
 
 #include <AMReX_Print.H>
 #include <algorithm>
+#include <set>
 
 namespace amr_wind::actuator {
 
@@ -29,6 +30,15 @@ ActuatorContainer::ActuatorContainer(
     , m_proc_offsets_device(amrex::ParallelDescriptor::NProcs() + 1)
 {}
 
+ActuatorContainer::~ActuatorContainer()
+{
+#ifdef AMREX_USE_MPI
+    if (m_gather_comm != MPI_COMM_NULL) {
+        MPI_Comm_free(&m_gather_comm);
+    }
+#endif
+}
+
 /** Allocate memory and initialize the particles within the container
  *
  *  This method is only called once during the simulation. It allocates the
@@ -70,9 +80,75 @@ void ActuatorContainer::initialize_container()
             m_proc_offsets.end(), m_proc_offsets_device.begin());
     }
 
+    // Only the points created on this rank are gathered until particles from
+    // other ranks are found during sampling
+    update_gather_pattern({});
+
     initialize_particles(total_pts);
 }
 
+/** Update the ranks exchanging sampled data with this rank
+ *
+ *  Each rank adds edges to the ranks that created the particles it holds. A
+ *  distributed graph communicator is created from these edges so that each
+ *  rank also learns which ranks send data to it. The gather then involves only
+ *  the ranks that are influenced by the actuators on this rank instead of all
+ *  ranks in the domain. Must be called by all ranks.
+ *
+ *  \param new_dst Additional ranks that this rank sends sampled data to
+ */
+void ActuatorContainer::update_gather_pattern(const amrex::Vector<int>& new_dst)
+{
+    BL_PROFILE("amr-wind::actuator::ActuatorContainer::update_gather_pattern");
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+
+    std::set<int> dst(m_gather_dst.begin(), m_gather_dst.end());
+    dst.insert(new_dst.begin(), new_dst.end());
+    dst.erase(iproc);
+    m_gather_dst.assign(dst.begin(), dst.end());
+    m_gather_src.clear();
+
+#ifdef AMREX_USE_MPI
+    if (m_gather_comm != MPI_COMM_NULL) {
+        MPI_Comm_free(&m_gather_comm);
+    }
+
+    {
+        const int degree = static_cast<int>(m_gather_dst.size());
+        MPI_Dist_graph_create(
+            amrex::ParallelDescriptor::Communicator(), 1, &iproc, &degree,
+            m_gather_dst.data(), MPI_UNWEIGHTED, MPI_INFO_NULL, 0,
+            &m_gather_comm);
+
+        int indegree = 0;
+        int outdegree = 0;
+        int weighted = 0;
+        MPI_Dist_graph_neighbors_count(
+            m_gather_comm, &indegree, &outdegree, &weighted);
+        m_gather_src.resize(indegree);
+        m_gather_dst.resize(outdegree);
+        MPI_Dist_graph_neighbors(
+            m_gather_comm, indegree, m_gather_src.data(), MPI_UNWEIGHTED,
+            outdegree, m_gather_dst.data(), MPI_UNWEIGHTED);
+    }
+#endif
+
+    // Send buffer holds the points of this rank followed by the points of
+    // every destination rank
+    m_send_offsets.assign(nprocs, -1);
+    m_send_offsets[iproc] = 0;
+    int offset = m_proc_offsets[iproc + 1] - m_proc_offsets[iproc];
+    for (const int ip : m_gather_dst) {
+        m_send_offsets[ip] = offset;
+        offset += m_proc_offsets[ip + 1] - m_proc_offsets[ip];
+    }
+    m_send_offsets_device.resize(nprocs);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, m_send_offsets.begin(), m_send_offsets.end(),
+        m_send_offsets_device.begin());
+}
+
 void ActuatorContainer::initialize_particles(const int total_pts)
 {
     // Initialize particle container data structures.
@@ -207,7 +283,11 @@ void ActuatorContainer::sample_fields(const Field& vel, const Field& density)
     // Redistribute();
 
     // Populate the velocity buffer that all actuator instances can access
-    populate_field_buffers();
+    if (m_sparse_gather) {
+        populate_field_buffers_sparse();
+    } else {
+        populate_field_buffers();
+    }
 
     // Indicate that the particles have been restored to their original MPI rank
     m_is_scattered = false;
@@ -273,6 +353,134 @@ void ActuatorContainer::populate_field_buffers()
     }
 }
 
+/** Helper method for ActuatorContainer::sample_fields
+ *
+ *  Same as ActuatorContainer::populate_field_buffers, but each rank only
+ *  exchanges data with the ranks that hold its particles instead of reducing
+ *  the data for all particles in the domain across all ranks. If particles
+ *  are found whose creating rank is not yet a known destination, the
+ *  communication pattern is updated on all ranks before the exchange.
+ */
+void ActuatorContainer::populate_field_buffers_sparse()
+{
+    BL_PROFILE(
+        "amr-wind::actuator::ActuatorContainer::populate_vel_buffer_sparse");
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    const int npts_local = m_proc_offsets[iproc + 1] - m_proc_offsets[iproc];
+    int npts_send = npts_local;
+    for (const int ip : m_gather_dst) {
+        npts_send += m_proc_offsets[ip + 1] - m_proc_offsets[ip];
+    }
+
+    const size_t num_buff_entries =
+        npts_send * static_cast<size_t>(NumPStructReal);
+    amrex::Vector<amrex::Real> buff_host(num_buff_entries);
+    amrex::Gpu::DeviceVector<amrex::Real> buff_device(num_buff_entries, 0.0);
+    amrex::Gpu::DeviceVector<int> unknown_dst(nprocs + 1, 0);
+
+    auto* buffer_pointer = buff_device.data();
+    auto* offsets = m_send_offsets_device.data();
+    auto* unknown = unknown_dst.data();
+
+    const int nlevels = m_mesh.finestLevel() + 1;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            const int np = pti.numParticles();
+            auto* pstruct = pti.GetArrayOfStructs()().data();
+
+            amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                auto& pp = pstruct[ip];
+                const auto ioff = offsets[pp.cpu()];
+                if (ioff < 0) {
+                    // Flag the rank and the total count of unknown ranks
+                    unknown[pp.cpu()] = 1;
+                    unknown[nprocs] = 1;
+                    return;
+                }
+                const auto idx = ioff + pp.idata(0);
+
+                for (int n = 0; n < NumPStructReal; ++n) {
+                    buffer_pointer[idx * NumPStructReal + n] = pp.rdata(n);
+                }
+            });
+        }
+    }
+
+    // Check if the particles moved into ranks that were not exchanging data
+    {
+        int found_unknown = 0;
+        amrex::Gpu::copy(
+            amrex::Gpu::deviceToHost, unknown_dst.begin() + nprocs,
+            unknown_dst.end(), &found_unknown);
+        amrex::ParallelDescriptor::ReduceIntMax(found_unknown);
+
+        if (found_unknown > 0) {
+            amrex::Vector<int> flags(nprocs + 1);
+            amrex::Gpu::copy(
+                amrex::Gpu::deviceToHost, unknown_dst.begin(),
+                unknown_dst.end(), flags.begin());
+            amrex::Vector<int> new_dst;
+            for (int ip = 0; ip < nprocs; ++ip) {
+                if (flags[ip] > 0) {
+                    new_dst.push_back(ip);
+                }
+            }
+            update_gather_pattern(new_dst);
+            populate_field_buffers_sparse();
+            return;
+        }
+    }
+
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, buff_device.begin(), buff_device.end(),
+        buff_host.begin());
+
+    // Contributions from this rank followed by those of each source rank
+    const int nsrc = static_cast<int>(m_gather_src.size());
+    const int seg_size = npts_local * NumPStructReal;
+    amrex::Vector<amrex::Real> recv_host(
+        static_cast<size_t>(nsrc) * seg_size, 0.0);
+#ifdef AMREX_USE_MPI
+    if (m_gather_comm != MPI_COMM_NULL) {
+        const int ndst = static_cast<int>(m_gather_dst.size());
+        amrex::Vector<int> send_counts(ndst), send_displs(ndst);
+        for (int i = 0; i < ndst; ++i) {
+            const int ip = m_gather_dst[i];
+            send_counts[i] =
+                (m_proc_offsets[ip + 1] - m_proc_offsets[ip]) * NumPStructReal;
+            send_displs[i] = m_send_offsets[ip] * NumPStructReal;
+        }
+        amrex::Vector<int> recv_counts(nsrc, seg_size), recv_displs(nsrc);
+        for (int i = 0; i < nsrc; ++i) {
+            recv_displs[i] = i * seg_size;
+        }
+        MPI_Neighbor_alltoallv(
+            buff_host.data(), send_counts.data(), send_displs.data(),
+            MPI_DOUBLE, recv_host.data(), recv_counts.data(),
+            recv_displs.data(), MPI_DOUBLE, m_gather_comm);
+    }
+#endif
+    {
+        auto& vel_arr = m_data.velocity;
+        auto& den_arr = m_data.density;
+        for (int i = 0; i < npts_local; ++i) {
+            amrex::Real vals[NumPStructReal];
+            for (int j = 0; j < NumPStructReal; ++j) {
+                const int ioff = i * NumPStructReal + j;
+                vals[j] = buff_host[ioff];
+                for (int is = 0; is < nsrc; ++is) {
+                    vals[j] += recv_host[is * seg_size + ioff];
+                }
+            }
+            for (int j = 0; j < AMREX_SPACEDIM; ++j) {
+                vel_arr[i][j] = vals[j];
+            }
+            den_arr[i] = vals[AMREX_SPACEDIM];
+        }
+    }
+}
+
 /** Helper method for ActuatorContainer::sample_fields
  *
  *  Performs a trilinear interpolation of the velocity/density field to particle
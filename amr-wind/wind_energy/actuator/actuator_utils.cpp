@@ -40,6 +40,16 @@ std::set<int> determine_influenced_procs(
     const amrex::AmrCore& mesh, const amrex::RealBox& rbx)
 {
     std::set<int> procs;
+    for (const auto& it : influenced_proc_cells(mesh, rbx)) {
+        procs.insert(it.first);
+    }
+    return procs;
+}
+
+std::map<int, amrex::Long> influenced_proc_cells(
+    const amrex::AmrCore& mesh, const amrex::RealBox& rbx)
+{
+    std::map<int, amrex::Long> cells;
     const int finest_level = mesh.finestLevel();
     const int nlevels = mesh.finestLevel() + 1;
     auto bx = realbox_to_box(rbx, mesh.Geom(0));
@@ -51,9 +61,9 @@ std::set<int> determine_influenced_procs(
         // Get all possible intersections at this level
         const auto& isects = ba.intersections(bx);
 
-        // Extract the processor ranks
+        // Extract the processor ranks and the size of the overlap
         for (const auto& is : isects) {
-            procs.insert(dm[is.first]);
+            cells[dm[is.first]] += is.second.numPts();
         }
 
         if (lev < finest_level) {
@@ -61,52 +71,48 @@ std::set<int> determine_influenced_procs(
         }
     }
 
-    return procs;
+    return cells;
 }
 
-void determine_root_proc(ActInfo& info, amrex::Vector<int>& act_proc_count)
+void determine_root_proc(
+    const amrex::AmrCore& mesh,
+    ActInfo& info,
+    amrex::Vector<int>& act_proc_count)
 {
     auto& plist = info.procs;
-    bool assigned = false;
+    const auto cells = influenced_proc_cells(mesh, info.bound_box);
 
-    // If any of the influenced procs is free (i.e., doesn't have a turbine
-    // assigned to it) elect it as the root proc for this turbine and return
-    // early.
+    // Pick the least loaded influenced process, preferring the one that owns
+    // the largest part of the actuator
+    int local_proc = -1;
+    amrex::Long local_cells = -1;
     for (auto ip : plist) {
-        if (act_proc_count[ip] < 1) {
-            info.root_proc = ip;
-            ++act_proc_count[ip];
-            assigned = true;
-            break;
+        const auto found = cells.find(ip);
+        const amrex::Long ncells = (found != cells.end()) ? found->second : 0;
+        if ((local_proc < 0) ||
+            (act_proc_count[ip] < act_proc_count[local_proc]) ||
+            ((act_proc_count[ip] == act_proc_count[local_proc]) &&
+             (ncells > local_cells))) {
+            local_proc = ip;
+            local_cells = ncells;
         }
     }
 
-    // If we found a root proc there is nothing more to do, so return early
-    if (assigned) {
-        const int iproc = amrex::ParallelDescriptor::MyProc();
-        auto in_proc = info.procs.find(iproc);
-        info.actuator_in_proc = (in_proc != info.procs.end());
-        info.is_root_proc = (info.root_proc == iproc);
-
-        // By default we request all processes where turbine is active to have
-        // velocities sampled. Individual actuator instances can override this
-        info.sample_vel_in_proc = info.actuator_in_proc;
-        return;
+    // If all influenced processes manage more turbines than some other
+    // process, assign the current turbine to the process that is managing the
+    // lowest number of turbines.
+    auto it = std::min_element(act_proc_count.begin(), act_proc_count.end());
+    if ((local_proc > -1) && (act_proc_count[local_proc] <= *it)) {
+        info.root_proc = local_proc;
+    } else {
+        info.root_proc =
+            static_cast<int>(std::distance(act_proc_count.begin(), it));
     }
 
-    // If we have reached here, then we have more turbines than processes
-    // available. We will assign the current turbine to the process that is
-    // managing the lowest number of turbines.
-
-    // Determine the MPI rank that contains the fewest turbines
-    auto it = std::min_element(act_proc_count.begin(), act_proc_count.end());
-    // Make it the root process for this turbine
-    info.root_proc =
-        static_cast<int>(std::distance(act_proc_count.begin(), it));
     // Make sure the root process is part of the process list
     plist.insert(info.root_proc);
     // Increment turbine count with the global tracking array
-    ++(*it);
+    ++act_proc_count[info.root_proc];
 
     {
         const int iproc = amrex::ParallelDescriptor::MyProc();
@@ -120,4 +126,15 @@ void determine_root_proc(ActInfo& info, amrex::Vector<int>& act_proc_count)
     }
 }
 
+amrex::RealBox
+gaussian_support_box(const vs::Vector& pos, const vs::Vector& eps)
+{
+    const amrex::Real emax = amrex::max(
+        std::abs(eps.x()), amrex::max(std::abs(eps.y()), std::abs(eps.z())));
+    const amrex::Real rad = gaussian_cutoff * emax;
+    return amrex::RealBox(
+        pos.x() - rad, pos.y() - rad, pos.z() - rad, pos.x() + rad,
+        pos.y() + rad, pos.z() + rad);
+}
+
 } // namespace amr_wind::actuator::utils
@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <stdexcept>
 
 namespace exw_fast {
 namespace {
@@ -26,6 +27,24 @@ inline void fast_func(const FType&& func, Args... args)
     }
 }
 
+/** Call an OpenFAST function on a worker thread
+ *
+ *  Same as fast_func, but errors are reported with exceptions that are
+ *  rethrown on the main thread when waiting for the worker.
+ */
+template <typename FType, class... Args>
+inline void fast_func_worker(const FType&& func, Args... args)
+{
+    int ierr = ErrID_None;
+    char err_msg[fast_strlen()];
+    func(std::forward<Args>(args)..., &ierr, err_msg);
+    if (ierr >= ErrID_Fatal) {
+        throw std::runtime_error(
+            "FastIface: Error calling OpenFAST function: \n" +
+            std::string(err_msg));
+    }
+}
+
 inline void copy_filename(const std::string& inp, char* out)
 {
     const int str_len = static_cast<int>(inp.size());
@@ -45,6 +64,16 @@ FastIface::FastIface(const amr_wind::CFDSim& /*unused*/) {}
 
 FastIface::~FastIface()
 {
+    // Turbines cannot be deallocated while they are being advanced
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_stop_workers = true;
+    }
+    m_queue_cv.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+
     int ierr = ErrID_None;
     char err_msg[fast_strlen()];
     FAST_DeallocateTurbines(&ierr, err_msg);
@@ -129,6 +158,7 @@ void FastIface::init_solution(const int local_id)
     AMREX_ALWAYS_ASSERT(local_id < static_cast<int>(m_turbine_data.size()));
     AMREX_ALWAYS_ASSERT(m_is_initialized);
 
+    sync_turbine(local_id);
     auto& fi = *m_turbine_data[local_id];
     fast_func(FAST_OpFM_Solution0, &fi.tid_local);
     fi.is_solution0 = false;
@@ -139,7 +169,101 @@ void FastIface::advance_turbine(const int local_id)
     BL_PROFILE("amr-wind::FastIface::advance_turbine");
     AMREX_ASSERT(local_id < static_cast<int>(m_turbine_data.size()));
 
+    sync_turbine(local_id);
     auto& fi = *m_turbine_data[local_id];
+    prepare_advance(fi);
+    try {
+        step_turbine(fi);
+    } catch (const std::exception& err) {
+        amrex::Abort(err.what());
+    }
+}
+
+void FastIface::advance_turbine_async(const int local_id)
+{
+    BL_PROFILE("amr-wind::FastIface::advance_turbine_async");
+    AMREX_ASSERT(local_id < static_cast<int>(m_turbine_data.size()));
+
+    wait_turbine(local_id);
+    auto& fi = *m_turbine_data[local_id];
+    prepare_advance(fi);
+
+    if (m_workers.empty()) {
+        start_workers();
+    }
+    std::packaged_task<void()> task([&fi]() { step_turbine(fi); });
+    m_pending_steps[local_id] = task.get_future();
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_queue.push_back(std::move(task));
+    }
+    m_queue_cv.notify_one();
+}
+
+void FastIface::wait_turbine(const int local_id)
+{
+    auto found = m_pending_steps.find(local_id);
+    if ((found == m_pending_steps.end()) || !found->second.valid()) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::FastIface::wait_turbine");
+    try {
+        found->second.get();
+    } catch (const std::exception& err) {
+        amrex::Abort(err.what());
+    }
+}
+
+void FastIface::allow_concurrent_steps()
+{
+    AMREX_ALWAYS_ASSERT(m_workers.empty());
+    m_concurrent = true;
+}
+
+void FastIface::sync_turbine(const int local_id)
+{
+    if (m_concurrent) {
+        wait_turbine(local_id);
+        return;
+    }
+
+    // OpenFAST might not support calls from several threads, wait until no
+    // turbine is being advanced on the worker thread
+    for (auto& it : m_pending_steps) {
+        wait_turbine(it.first);
+    }
+}
+
+void FastIface::start_workers()
+{
+    const int nworkers = m_concurrent ? std::max(num_local_turbines(), 1) : 1;
+    for (int i = 0; i < nworkers; ++i) {
+        m_workers.emplace_back([this]() { worker_loop(); });
+    }
+}
+
+void FastIface::worker_loop()
+{
+    for (;;) {
+        std::packaged_task<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_queue_mutex);
+            m_queue_cv.wait(
+                lock, [this]() { return m_stop_workers || !m_queue.empty(); });
+            // Queued advances are completed before the workers stop
+            if (m_queue.empty()) {
+                return;
+            }
+            task = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+        task();
+    }
+}
+
+void FastIface::prepare_advance(FastTurbine& fi)
+{
     AMREX_ASSERT(!fi.is_solution0);
     {
         const auto& tmax = fi.stop_time;
@@ -156,15 +280,19 @@ void FastIface::advance_turbine(const int local_id)
     }
 
     write_velocity_data(fi);
+}
+
+void FastIface::step_turbine(FastTurbine& fi)
+{
     for (int i = 0; i < fi.num_substeps; ++i, ++fi.time_index) {
-        fast_func(FAST_OpFM_Step, &fi.tid_local);
+        fast_func_worker(FAST_OpFM_Step, &fi.tid_local);
     }
 
     if (fi.chkpt_interval > 0 &&
         (fi.time_index / fi.num_substeps) % fi.chkpt_interval == 0) {
         char rst_file[fast_strlen()];
         copy_filename(" ", rst_file);
-        fast_func(FAST_CreateCheckpoint, &fi.tid_local, rst_file);
+        fast_func_worker(FAST_CreateCheckpoint, &fi.tid_local, rst_file);
     }
 }
 
@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+#
+# Script to convert ASCII HOS wave files to the binary format read by the
+# HOSWaves relaxation zone model (OceanWaves.<label>.HOS_file_format = binary)
+#
+# usage: hos2binary.py [-h] [--outdir OUTDIR] files [files ...]
+#
+# positional arguments:
+#   files            ASCII HOS files (<prefix>_lev<N>_<n>.txt)
+#
+# optional arguments:
+#   -h, --help       show this help message and exit
+#   --outdir OUTDIR  directory for the binary files (default: next to input)
+
+import os
+import sys
+import struct
+import argparse
+from array import array
+
+TAG = b"AMRWHOS1"
+
+
+def read_text(fname):
+    """Parse an ASCII HOS file"""
+    with open(fname, "r") as f:
+        hdr = [f.readline() for _ in range(5)]
+        # Skip key
+        f.readline()
+        vals = [float(x) for x in f.read().split()]
+
+    def value(entry):
+        return entry.split("=")[1].strip()
+
+    t = float(value(hdr[0]))
+    dt = float(value(hdr[1]))
+    nx_lx = hdr[2].split(",")
+    nx, lx = int(value(nx_lx[0])), float(value(nx_lx[1]))
+    ny_ly = hdr[3].split(",")
+    ny, ly = int(value(ny_ly[0])), float(value(ny_ly[1]))
+    nz_z = hdr[4].split(",")
+    nz = int(value(nz_z[0]))
+    zmin, zmax = float(value(nz_z[1])), float(value(nz_z[2]))
+
+    # Each lateral point has eta followed by (u, v, w) for each vertical point
+    stride = 1 + 3 * nz
+    npts = nx * ny
+    eta = array("d", vals[0 : npts * stride : stride])
+    vel = []
+    for i in range(3):
+        comp = array("d")
+        for ilat in range(npts):
+            start = ilat * stride + 1 + i
+            comp.extend(vals[start : start + 3 * nz : 3])
+        vel.append(comp)
+    return (nx, ny, nz), (t, dt, lx, ly, zmin, zmax), eta, vel
+
+
+def write_binary(fname, dims, hdr, eta, vel):
+    """Write the binary HOS file (little endian)"""
+    with open(fname, "wb") as f:
+        f.write(TAG)
+        f.write(struct.pack("<4i", dims[0], dims[1], dims[2], 0))
+        f.write(struct.pack("<6d", *hdr))
+        for arr in [eta] + vel:
+            if sys.byteorder != "little":
+                arr.byteswap()
+            arr.tofile(f)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert ASCII HOS files to AMR-Wind binary HOS files"
+    )
+    parser.add_argument("files", nargs="+", help="ASCII HOS files")
+    parser.add_argument(
+        "--outdir", default=None, help="directory for the binary files"
+    )
+    args = parser.parse_args()
+
+    for fname in args.files:
+        base = os.path.splitext(os.path.basename(fname))[0] + ".bin"
+        outdir = args.outdir if args.outdir else os.path.dirname(fname)
+        outname = os.path.join(outdir, base)
+        write_binary(outname, *read_text(fname))
+        print(fname + " -> " + outname)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,129 @@
+#!/usr/bin/env python
+#
+# Script to summarize the per-timestep performance report written by AMR-Wind
+# (io.perf_report = true) and to check it against a stored baseline
+#
+# usage: perf_compare.py [-h] [--baseline BASELINE] [--save SAVE]
+#                        [--skip SKIP] [--tolerance TOLERANCE] report
+#
+# positional arguments:
+#   report                 performance report (JSON lines format)
+#
+# optional arguments:
+#   -h, --help             show this help message and exit
+#   --baseline BASELINE    baseline summary to compare against
+#   --save SAVE            write the summary of this report to a file
+#   --skip SKIP            number of initial timesteps to ignore (default: 2)
+#   --tolerance TOLERANCE  allowed relative slowdown (default: 0.1)
+#
+# The script exits with a non-zero status if the throughput (cells advanced
+# per second) dropped, or the mean number of iterations of a linear solve
+# increased, by more than the tolerance relative to the baseline.
+
+import sys
+import json
+import argparse
+from statistics import mean, median
+
+
+def read_report(fname):
+    """Read a JSON lines performance report"""
+    with open(fname, "r") as f:
+        return [json.loads(line) for line in f if line.strip()]
+
+
+def summarize(steps):
+    """Average the timings and iteration counts over timesteps"""
+    summary = {
+        "num_steps": len(steps),
+        "nprocs": steps[0]["nprocs"],
+        "num_cells": steps[-1]["num_cells"],
+        "cells_per_sec": median(s["cells_per_sec"] for s in steps),
+        "total": mean(s["total"] for s in steps),
+        "regions": {},
+        "solves": {},
+    }
+    for name in steps[0]["regions"]:
+        summary["regions"][name] = mean(s["regions"][name]["max"] for s in steps)
+
+    iters = {}
+    for s in steps:
+        for sv in s["solves"]:
+            iters.setdefault(sv["name"], []).append(sv["iters"])
+    for name, vals in iters.items():
+        summary["solves"][name] = mean(vals)
+    return summary
+
+
+def print_summary(summary):
+    print("Steps: %d, ranks: %d, cells: %d" % (
+        summary["num_steps"], summary["nprocs"], summary["num_cells"]))
+    print("Throughput: %.4g cells/s, mean step time: %.4g s" % (
+        summary["cells_per_sec"], summary["total"]))
+    for name, val in summary["regions"].items():
+        print("  %-16s %12.4g s" % (name, val))
+    for name, val in summary["solves"].items():
+        print("  %-32s %8.2f iters" % (name, val))
+
+
+def compare(summary, baseline, tol):
+    """Return a list of regressions relative to the baseline"""
+    failures = []
+    if summary["nprocs"] != baseline["nprocs"]:
+        print("WARNING: baseline was run with %d ranks, this run used %d" % (
+            baseline["nprocs"], summary["nprocs"]))
+
+    ratio = summary["cells_per_sec"] / baseline["cells_per_sec"]
+    print("Throughput relative to baseline: %.3f" % ratio)
+    if ratio < 1.0 - tol:
+        failures.append("throughput dropped to %.3f of baseline" % ratio)
+
+    for name, val in summary["regions"].items():
+        ref = baseline["regions"].get(name, 0.0)
+        if ref > 0.0 and val > (1.0 + tol) * ref:
+            print("  %s: %.4g s (baseline %.4g s)" % (name, val, ref))
+
+    for name, val in summary["solves"].items():
+        ref = baseline["solves"].get(name)
+        if ref is not None and val > (1.0 + tol) * ref + 0.5:
+            failures.append("%s iterations increased from %.2f to %.2f" % (
+                name, ref, val))
+    return failures
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Summarize and compare AMR-Wind performance reports")
+    parser.add_argument("report", help="performance report (JSON lines)")
+    parser.add_argument("--baseline", help="baseline summary to compare against")
+    parser.add_argument("--save", help="write the summary to this file")
+    parser.add_argument("--skip", type=int, default=2,
+                        help="number of initial timesteps to ignore")
+    parser.add_argument("--tolerance", type=float, default=0.1,
+                        help="allowed relative slowdown")
+    args = parser.parse_args()
+
+    steps = read_report(args.report)
+    if len(steps) > args.skip:
+        steps = steps[args.skip:]
+    if not steps:
+        sys.exit("No timesteps found in " + args.report)
+
+    summary = summarize(steps)
+    print_summary(summary)
+    if args.save:
+        with open(args.save, "w") as f:
+            json.dump(summary, f, indent=2)
+
+    if args.baseline:
+        with open(args.baseline, "r") as f:
+            baseline = json.load(f)
+        failures = compare(summary, baseline, args.tolerance)
+        if failures:
+            for msg in failures:
+                print("REGRESSION: " + msg)
+            sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
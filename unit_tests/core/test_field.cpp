@@ -312,6 +312,55 @@ TEST_F(FieldRepoTest, scratch_fields)
     }
 }
 
+TEST_F(FieldRepoTest, scratch_field_pool)
+{
+    populate_parameters();
+    initialize_mesh();
+
+    auto& frepo = mesh().field_repo();
+    auto& pool = frepo.scratch_pool();
+    EXPECT_TRUE(pool.enabled());
+    EXPECT_EQ(pool.bytes_in_use(), 0);
+
+    const amrex::Real* ptr = nullptr;
+    {
+        auto sfield = frepo.create_scratch_field(3, 1);
+        EXPECT_GT(pool.bytes_in_use(), 0);
+        EXPECT_EQ(pool.step_high_water_mark(), pool.bytes_in_use());
+        if ((*sfield)(0).local_size() > 0) {
+            ptr = (*sfield)(0).atLocalIdx(0).dataPtr();
+        }
+    }
+    EXPECT_EQ(pool.bytes_in_use(), 0);
+    EXPECT_GT(pool.bytes_pooled(), 0);
+
+    // A field with the same layout reuses the pooled data
+    {
+        auto sfield = frepo.create_scratch_field("other", 3, 1);
+        EXPECT_EQ(pool.bytes_pooled(), 0);
+        if (ptr != nullptr) {
+            EXPECT_EQ((*sfield)(0).atLocalIdx(0).dataPtr(), ptr);
+        }
+
+        // A different layout cannot use the pooled data
+        auto nfield =
+            frepo.create_scratch_field(3, 1, amr_wind::FieldLoc::NODE);
+        EXPECT_EQ(pool.bytes_pooled(), 0);
+        EXPECT_EQ(pool.bytes_in_use(), pool.step_high_water_mark());
+    }
+    EXPECT_GT(pool.bytes_pooled(), 0);
+
+    // Data is not retained once the pool is invalidated (e.g., on regrid)
+    pool.invalidate();
+    EXPECT_EQ(pool.bytes_pooled(), 0);
+
+    auto sfield = frepo.create_scratch_field(3, 1);
+    pool.invalidate();
+    sfield.reset();
+    EXPECT_EQ(pool.bytes_pooled(), 0);
+    EXPECT_EQ(pool.bytes_in_use(), 0);
+}
+
 TEST_F(FieldRepoTest, int_scratch_fields)
 {
 
@@ -52,4 +52,55 @@ TEST_F(FieldOpsTest, compute_max_magnitude)
     EXPECT_NEAR(global_maximum, 21.5, 1.0e-12);
 }
 
+TEST_F(FieldOpsTest, fused_expression)
+{
+    initialize_mesh();
+    auto& frepo = mesh().field_repo();
+    auto& x = frepo.declare_field("x", 3, 1);
+    auto& y = frepo.declare_field("y", 3, 1);
+    auto& z = frepo.declare_field("z", 3, 1);
+    auto dst = frepo.create_scratch_field(2, 0);
+
+    x.setVal(2.0);
+    y.setVal(-3.0);
+    z.setVal(0.5);
+    const int nlevels = frepo.num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        (*dst)(lev).setVal(10.0);
+    }
+
+    namespace fops = amr_wind::field_ops;
+
+    // dst = a * x + b * y - z using components 1 and 2 of the sources
+    fops::assign(
+        *dst,
+        1.5 * fops::term(x, 1) + 2.0 * fops::term(y, 1) - fops::term(z, 1), 0,
+        2, 0);
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        EXPECT_NEAR((*dst)(lev).min(0), -3.5, 1.0e-12);
+        EXPECT_NEAR((*dst)(lev).max(1), -3.5, 1.0e-12);
+    }
+
+    // destination can be used on the right hand side
+    fops::assign(
+        *dst, -(fops::term(*dst) / 0.5) + fops::term(x) * fops::term(z), 1, 1,
+        0);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        EXPECT_NEAR((*dst)(lev).min(0), -3.5, 1.0e-12);
+        EXPECT_NEAR((*dst)(lev).min(1), 8.0, 1.0e-12);
+        EXPECT_NEAR((*dst)(lev).max(1), 8.0, 1.0e-12);
+    }
+
+    // existing helpers are built on top of the expressions
+    fops::saxpy(x, 2.0, y, 0, 0, 3, 1);
+    fops::lincomb(z, 2.0, x, 0, -1.0, y, 0, 0, 3, 0);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        EXPECT_NEAR(x(lev).min(2, 1), -4.0, 1.0e-12);
+        EXPECT_NEAR(x(lev).max(2, 1), -4.0, 1.0e-12);
+        EXPECT_NEAR(z(lev).max(0), -5.0, 1.0e-12);
+        EXPECT_NEAR(z(lev).min(0), -5.0, 1.0e-12);
+    }
+}
+
 } // namespace amr_wind_tests
@@ -0,0 +1,98 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/core/LoadBalancer.H"
+#include "amr-wind/core/Physics.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+//! Physics adding a cost of 2 to every cell with x < 4
+class CostPhysics : public amr_wind::Physics::Register<CostPhysics>
+{
+public:
+    static std::string identifier() { return "CostPhysics"; }
+
+    explicit CostPhysics(amr_wind::CFDSim& sim) : m_sim(sim) {}
+
+    ~CostPhysics() override = default;
+
+    void post_init_actions() override {}
+    void post_regrid_actions() override {}
+    void
+    initialize_fields(int /*level*/, const amrex::Geometry& /*geom*/) override
+    {}
+    void pre_advance_work() override {}
+    void post_advance_work() override {}
+
+    void add_load_balance_cost(int lev, amrex::MultiFab& cost) const override
+    {
+        const auto& geom = m_sim.mesh().Geom(lev);
+        const auto problo = geom.ProbLoArray();
+        const auto dx = geom.CellSizeArray();
+        for (amrex::MFIter mfi(cost); mfi.isValid(); ++mfi) {
+            const auto& carr = cost.array(mfi);
+            amrex::ParallelFor(
+                mfi.validbox(), [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                    if (problo[0] + (i + 0.5) * dx[0] < 4.0) {
+                        carr(i, j, k) += 2.0;
+                    }
+                });
+        }
+    }
+
+private:
+    amr_wind::CFDSim& m_sim;
+};
+
+} // namespace
+
+class LoadBalancerTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+        amrex::ParmParse pp("amr");
+        pp.add("max_level", 1);
+        pp.add("max_grid_size", 4);
+    }
+};
+
+TEST_F(LoadBalancerTest, box_costs)
+{
+    initialize_mesh();
+    sim().physics_manager().create("CostPhysics", sim());
+
+    amr_wind::LoadBalancer lb(sim());
+    EXPECT_FALSE(lb.enabled());
+
+    // Current grids at level 0
+    const auto& ba = mesh().boxArray(0);
+    const auto costs = lb.box_costs(0, ba);
+    ASSERT_EQ(costs.size(), ba.size());
+    amrex::Real total = 0.0;
+    for (int i = 0; i < ba.size(); ++i) {
+        const amrex::Real expected = (ba[i].bigEnd(0) < 4) ? 192.0 : 64.0;
+        EXPECT_NEAR(costs[i], expected, 1.0e-12);
+        total += costs[i];
+    }
+    EXPECT_NEAR(total, 1024.0, 1.0e-12);
+
+    // New level estimated from level 0
+    amrex::BoxArray ba_fine(ba);
+    ba_fine.refine(2);
+    const auto fine_costs = lb.box_costs(1, ba_fine);
+    for (int i = 0; i < ba_fine.size(); ++i) {
+        const amrex::Real expected =
+            (ba_fine[i].bigEnd(0) < 8) ? 8.0 * 192.0 : 8.0 * 64.0;
+        EXPECT_NEAR(fine_costs[i], expected, 1.0e-12);
+    }
+
+    const auto dm = lb.make_distribution_map(0, ba);
+    EXPECT_EQ(dm.size(), ba.size());
+    const amrex::Real eff = amr_wind::LoadBalancer::efficiency(costs, dm);
+    EXPECT_GT(eff, 0.0);
+    EXPECT_LE(eff, 1.0 + 1.0e-12);
+}
+
+} // namespace amr_wind_tests
@@ -0,0 +1,133 @@
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/iter_tools.H"
+#include "amr-wind/core/VelocityGradient.H"
+#include "amr-wind/fvm/gradient.H"
+#include "amr-wind/fvm/strainrate.H"
+#include "amr-wind/fvm/vorticity_mag.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+void init_velocity(amr_wind::Field& vel)
+{
+    const auto& geom = vel.repo().mesh().Geom();
+    run_algorithm(vel, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto& bx = mfi.growntilebox();
+        const auto& problo = geom[lev].ProbLoArray();
+        const auto& dx = geom[lev].CellSizeArray();
+        const auto& varr = vel(lev).array(mfi);
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+            const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+            const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+            varr(i, j, k, 0) = x * y + 2.0 * z;
+            varr(i, j, k, 1) = y * y - 3.0 * x * z;
+            varr(i, j, k, 2) = 0.5 * x + y * z * z;
+        });
+    });
+}
+
+//! Maximum absolute difference between two MultiFabs
+amrex::Real max_diff(const amrex::MultiFab& lhs, const amrex::MultiFab& rhs)
+{
+    amrex::MultiFab diff(lhs.boxArray(), lhs.DistributionMap(), lhs.nComp(), 0);
+    amrex::MultiFab::Copy(diff, lhs, 0, 0, lhs.nComp(), 0);
+    amrex::MultiFab::Subtract(diff, rhs, 0, 0, lhs.nComp(), 0);
+    return diff.norminf(0, lhs.nComp(), amrex::IntVect(0));
+}
+
+} // namespace
+
+class VelocityGradientTest : public MeshTest
+{};
+
+TEST_F(VelocityGradientTest, cached_gradient)
+{
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vel = repo.declare_field("velocity", AMREX_SPACEDIM, 1, 2);
+    auto& vel_old = vel.state(amr_wind::FieldState::Old);
+    init_velocity(vel);
+    init_velocity(vel_old);
+
+    auto& vel_grad = sim().velocity_gradient();
+    EXPECT_EQ(vel_grad.num_evaluations(), 0);
+
+    // Gradient is identical to the fvm operator
+    auto ref_grad = amr_wind::fvm::gradient(vel);
+    const auto& grad = vel_grad(0);
+    EXPECT_EQ(vel_grad.num_evaluations(), 1);
+    EXPECT_NEAR(max_diff(grad, (*ref_grad)(0)), 0.0, 1.0e-12);
+
+    // Derived quantities reuse the cached tensor
+    auto ref_str = amr_wind::fvm::strainrate(vel);
+    auto str = repo.create_scratch_field(1, 0);
+    vel_grad.strainrate(*str);
+    EXPECT_NEAR(max_diff((*str)(0), (*ref_str)(0)), 0.0, 1.0e-12);
+
+    auto ref_vort = amr_wind::fvm::vorticity_mag(vel);
+    auto vort = repo.create_scratch_field(1, 0);
+    vel_grad.vorticity_mag(*vort);
+    EXPECT_NEAR(max_diff((*vort)(0), (*ref_vort)(0)), 0.0, 1.0e-12);
+    EXPECT_EQ(vel_grad.num_evaluations(), 1);
+
+    // States are cached independently
+    vel_grad(0, amr_wind::FieldState::Old);
+    EXPECT_EQ(vel_grad.num_evaluations(), 2);
+    vel_grad(0, amr_wind::FieldState::Old);
+    EXPECT_EQ(vel_grad.num_evaluations(), 2);
+
+    // Updated velocity is picked up after invalidation
+    vel.setVal(1.0);
+    vel_grad.invalidate();
+    const auto& grad_const = vel_grad(0);
+    EXPECT_EQ(vel_grad.num_evaluations(), 3);
+    EXPECT_NEAR(grad_const.norminf(0, grad_const.nComp()), 0.0, 1.0e-12);
+
+    // A new timestep invalidates the cache
+    time().time_index() += 1;
+    vel_grad(0);
+    EXPECT_EQ(vel_grad.num_evaluations(), 4);
+}
+
+TEST_F(VelocityGradientTest, tracks_velocity_updates)
+{
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vel = repo.declare_field("velocity", AMREX_SPACEDIM, 1, 2);
+    init_velocity(vel);
+
+    auto& vel_grad = sim().velocity_gradient();
+    vel_grad(0);
+    EXPECT_EQ(vel_grad.num_evaluations(), 1);
+
+    // Read-only access to the velocity keeps the cached tensor
+    const auto& cvel = vel;
+    EXPECT_GT(cvel(0).norminf(0, AMREX_SPACEDIM), 0.0);
+    vel_grad(0);
+    EXPECT_EQ(vel_grad.num_evaluations(), 1);
+
+    // Velocity modified within the same timestep without calling
+    // invalidate(), e.g., by a physics post_advance_work hook
+    const auto& geom = repo.mesh().Geom();
+    run_algorithm(vel, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto& bx = mfi.growntilebox();
+        const auto& problo = geom[lev].ProbLoArray();
+        const auto& dx = geom[lev].CellSizeArray();
+        const auto& varr = vel(lev).array(mfi);
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            varr(i, j, k, 0) = 3.0 * (problo[0] + (i + 0.5) * dx[0]);
+            varr(i, j, k, 1) = 0.0;
+            varr(i, j, k, 2) = 0.0;
+        });
+    });
+
+    const auto& grad = vel_grad(0);
+    EXPECT_EQ(vel_grad.num_evaluations(), 2);
+    EXPECT_NEAR(grad.min(0), 3.0, 1.0e-12);
+    EXPECT_NEAR(grad.max(0), 3.0, 1.0e-12);
+    EXPECT_NEAR(grad.norminf(1, grad.nComp() - 1), 0.0, 1.0e-12);
+}
+
+} // namespace amr_wind_tests
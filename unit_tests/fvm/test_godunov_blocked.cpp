@@ -0,0 +1,94 @@
+#include "aw_test_utils/AmrexTest.H"
+#include "amr-wind/convection/Godunov.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+void init_fab(amrex::FArrayBox& fab, const amrex::Real phase)
+{
+    const auto& arr = fab.array();
+    amrex::ParallelFor(
+        fab.box(), fab.nComp(),
+        [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) {
+            arr(i, j, k, n) = 0.5 + std::sin(0.4 * i + phase + n) *
+                                        std::cos(0.3 * j - 0.2 * k);
+        });
+}
+
+} // namespace
+
+class GodunovBlockedTest : public AmrexTest
+{};
+
+TEST_F(GodunovBlockedTest, matches_unblocked)
+{
+    constexpr int ncomp = 2;
+    const amrex::Box domain(amrex::IntVect(0), amrex::IntVect(15));
+    const amrex::RealBox rb(
+        {AMREX_D_DECL(0.0, 0.0, 0.0)}, {AMREX_D_DECL(1.0, 1.0, 1.0)});
+    const amrex::Array<int, AMREX_SPACEDIM> periodic{AMREX_D_DECL(1, 1, 1)};
+    const amrex::Vector<amrex::Geometry> geom{
+        amrex::Geometry(domain, rb, amrex::CoordSys::cartesian, periodic)};
+
+    const amrex::Box bx(amrex::IntVect(2), amrex::IntVect(13));
+    amrex::FArrayBox q(amrex::grow(bx, 4), ncomp);
+    amrex::FArrayBox fq(amrex::grow(bx, 2), ncomp);
+    amrex::Array<amrex::FArrayBox, AMREX_SPACEDIM> mac;
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        mac[d].resize(amrex::grow(amrex::surroundingNodes(bx, d), 2), 1);
+        init_fab(mac[d], 1.0 + d);
+    }
+    init_fab(q, 0.0);
+    init_fab(fq, 2.0);
+
+    amrex::Vector<amrex::BCRec> bcrec(ncomp);
+    for (auto& bc : bcrec) {
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            bc.setLo(d, amrex::BCType::int_dir);
+            bc.setHi(d, amrex::BCType::int_dir);
+        }
+    }
+    amrex::Gpu::DeviceVector<amrex::BCRec> bcrec_d(ncomp);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, bcrec.begin(), bcrec.end(),
+        bcrec_d.begin());
+    amrex::Gpu::DeviceVector<int> iconserv(ncomp, 1);
+
+    for (const auto scheme :
+         {godunov::scheme::PPM_NOLIM, godunov::scheme::WENOZ}) {
+        amrex::Array<amrex::FArrayBox, AMREX_SPACEDIM> flux;
+        amrex::Array<amrex::FArrayBox, AMREX_SPACEDIM> flux_blocked;
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            flux[d].resize(amrex::surroundingNodes(bx, d), ncomp);
+            flux_blocked[d].resize(amrex::surroundingNodes(bx, d), ncomp);
+            flux_blocked[d].setVal<amrex::RunOn::Device>(0.0);
+        }
+
+        amrex::FArrayBox tmpfab(
+            amrex::grow(bx, 1), ncomp * godunov::flux_scratch_comps);
+        godunov::compute_fluxes(
+            0, bx, ncomp, flux[0].array(), flux[1].array(), flux[2].array(),
+            q.const_array(), mac[0].const_array(), mac[1].const_array(),
+            mac[2].const_array(), fq.const_array(), bcrec_d.data(),
+            iconserv.data(), tmpfab.dataPtr(), geom, 0.01, scheme);
+
+        // Tiles that do not divide the box evenly
+        godunov::compute_fluxes_blocked(
+            0, bx, ncomp, flux_blocked[0].array(), flux_blocked[1].array(),
+            flux_blocked[2].array(), q.const_array(), mac[0].const_array(),
+            mac[1].const_array(), mac[2].const_array(), fq.const_array(),
+            bcrec_d.data(), iconserv.data(), geom, 0.01, scheme,
+            amrex::IntVect(AMREX_D_DECL(5, 4, 3)));
+        amrex::Gpu::streamSynchronize();
+
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            flux_blocked[d].minus<amrex::RunOn::Device>(flux[d]);
+            EXPECT_EQ(
+                flux_blocked[d].norm<amrex::RunOn::Device>(0, 0, ncomp), 0.0);
+            EXPECT_GT(flux[d].norm<amrex::RunOn::Device>(0, 0, ncomp), 0.0);
+        }
+    }
+}
+
+} // namespace amr_wind_tests
@@ -0,0 +1,201 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/immersed_boundary/IB.H"
+#include "amr-wind/core/vs/vector_space.H"
+
+#include <cstdio>
+#include <fstream>
+
+#include "AMReX_ParallelDescriptor.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+namespace vs = amr_wind::vs;
+
+//! Write the surface of the cube [lo, hi]^3 as an ASCII STL file, faces are
+//! split along the diagonals
+void write_cube_stl(
+    const std::string& fname, const amrex::Real lo, const amrex::Real hi)
+{
+    std::ofstream os(fname);
+    os << "solid cube\n";
+    for (int d = 0; d < 3; ++d) {
+        const int a = (d + 1) % 3;
+        const int b = (d + 2) % 3;
+        for (const amrex::Real side : {lo, hi}) {
+            amrex::Array<vs::Vector, 4> quad;
+            for (int n = 0; n < 4; ++n) {
+                quad[n][d] = side;
+                quad[n][a] = ((n == 1) || (n == 2)) ? hi : lo;
+                quad[n][b] = (n >= 2) ? hi : lo;
+            }
+            for (const auto& tri : {amrex::Array<int, 3>{0, 1, 2},
+                                    amrex::Array<int, 3>{0, 2, 3}}) {
+                os << "  facet normal 0 0 0\n    outer loop\n";
+                for (const int n : tri) {
+                    os << "      vertex " << quad[n].x() << " "
+                       << quad[n].y() << " " << quad[n].z() << "\n";
+                }
+                os << "    endloop\n  endfacet\n";
+            }
+        }
+    }
+    os << "endsolid cube\n";
+}
+
+} // namespace
+
+class IBLevelsetTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("IB");
+            amrex::Vector<std::string> labels{"cube", "ball"};
+            pp.addarr("labels", labels);
+        }
+        {
+            amrex::ParmParse pp("IB.cube");
+            pp.add("type", std::string("TriangulatedSurface"));
+            pp.add("surface_file", m_stl);
+            pp.add("is_moving", true);
+            amrex::Vector<amrex::Real> vel{m_vel, 0.0, 0.0};
+            pp.addarr("vel_bc", vel);
+        }
+        {
+            amrex::ParmParse pp("IB.ball");
+            pp.add("type", std::string("Sphere"));
+            amrex::Vector<amrex::Real> center{m_x0, m_x0, m_x0};
+            pp.addarr("center", center);
+            pp.add("radius", m_radius);
+        }
+    }
+
+    //! Number of cells where the sign of the level set does not match the
+    //! union of the sphere and the cube displaced by `disp`
+    int count_levelset_errors(const amrex::Real disp)
+    {
+        const auto& levelset = sim().repo().get_field("ib_levelset");
+        const auto& geom = mesh().Geom(0);
+        const auto& problo = geom.ProbLoArray();
+        const auto& dx = geom.CellSizeArray();
+        const amrex::Real x0 = m_x0;
+        const amrex::Real R = m_radius;
+        const amrex::Real lo = m_lo;
+        const amrex::Real hi = m_hi;
+        int nerr = amrex::ReduceSum(
+            levelset(0), 0,
+            [=] AMREX_GPU_HOST_DEVICE(
+                amrex::Box const& bx,
+                amrex::Array4<amrex::Real const> const& phi) -> int {
+                int count = 0;
+                amrex::Loop(bx, [=, &count](int i, int j, int k) noexcept {
+                    const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+                    const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                    const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+                    const amrex::Real r = std::sqrt(
+                        (x - x0) * (x - x0) + (y - x0) * (y - x0) +
+                        (z - x0) * (z - x0));
+                    const bool in_cube = (x > lo + disp) && (x < hi + disp) &&
+                                         (y > lo) && (y < hi) && (z > lo) &&
+                                         (z < hi);
+                    const bool inside = (r < R) || in_cube;
+                    // The sphere is exact everywhere, so the combined level
+                    // set can never be larger
+                    if (((phi(i, j, k) < 0.0) != inside) ||
+                        (phi(i, j, k) > r - R + 1.0e-12)) {
+                        ++count;
+                    }
+                });
+                return count;
+            });
+        amrex::ParallelDescriptor::ReduceIntSum(nerr);
+        return nerr;
+    }
+
+    //! Number of nodes where the mask does not match the union of the sphere
+    //! and the cube displaced by `disp`
+    int count_mask_errors(const amrex::Real disp)
+    {
+        const auto& mask_node = sim().repo().get_int_field("mask_node");
+        const auto& geom = mesh().Geom(0);
+        const auto& problo = geom.ProbLoArray();
+        const auto& dx = geom.CellSizeArray();
+        const amrex::Real x0 = m_x0;
+        const amrex::Real R = m_radius;
+        const amrex::Real lo = m_lo;
+        const amrex::Real hi = m_hi;
+        int nerr = amrex::ReduceSum(
+            mask_node(0), 0,
+            [=] AMREX_GPU_HOST_DEVICE(
+                amrex::Box const& bx,
+                amrex::Array4<int const> const& mask) -> int {
+                int count = 0;
+                amrex::Loop(bx, [=, &count](int i, int j, int k) noexcept {
+                    const amrex::Real x = problo[0] + i * dx[0];
+                    const amrex::Real y = problo[1] + j * dx[1];
+                    const amrex::Real z = problo[2] + k * dx[2];
+                    const amrex::Real r = std::sqrt(
+                        (x - x0) * (x - x0) + (y - x0) * (y - x0) +
+                        (z - x0) * (z - x0));
+                    const bool in_cube = (x > lo + disp) && (x < hi + disp) &&
+                                         (y > lo) && (y < hi) && (z > lo) &&
+                                         (z < hi);
+                    const int expected = ((r <= R) || in_cube) ? 0 : 1;
+                    if (mask(i, j, k) != expected) {
+                        ++count;
+                    }
+                });
+                return count;
+            });
+        amrex::ParallelDescriptor::ReduceIntSum(nerr);
+        return nerr;
+    }
+
+    const std::string m_stl{"ib_levelset_cube.stl"};
+    // The cube moves by two cells in a single step, no node or cell center
+    // lies on the surface of either body
+    const amrex::Real m_lo{1.25};
+    const amrex::Real m_hi{4.25};
+    const amrex::Real m_vel{20.0};
+    const amrex::Real m_dt{0.1};
+    const amrex::Real m_x0{2.0};
+    const amrex::Real m_radius{1.5};
+};
+
+TEST_F(IBLevelsetTest, moving_body_keeps_fixed_body)
+{
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        write_cube_stl(m_stl, m_lo, m_hi);
+    }
+    amrex::ParallelDescriptor::Barrier();
+
+    initialize_mesh();
+    auto& repo = sim().repo();
+    repo.declare_int_field("mask_node", 1, 1, 1, amr_wind::FieldLoc::NODE)
+        .setVal(1);
+
+    amr_wind::ib::IB ib(sim());
+    ib.pre_init_actions();
+    ib.post_init_actions();
+    EXPECT_EQ(count_levelset_errors(0.0), 0);
+    EXPECT_EQ(count_mask_errors(0.0), 0);
+
+    // The cube leaves the region it shared with the sphere, which must stay
+    // solid, while the nodes that only the cube covered become active again
+    sim().time().deltaT() = m_dt;
+    ib.post_advance_work();
+    EXPECT_EQ(count_levelset_errors(m_vel * m_dt), 0);
+    EXPECT_EQ(count_mask_errors(m_vel * m_dt), 0);
+
+    amrex::ParallelDescriptor::Barrier();
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::remove(m_stl.c_str());
+    }
+}
+
+} // namespace amr_wind_tests
@@ -0,0 +1,161 @@
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/iter_tools.H"
+#include "amr-wind/physics/multiphase/MultiPhase.H"
+#include "amr-wind/equation_systems/vof/vof.H"
+#include "amr-wind/equation_systems/vof/SplitAdvection.H"
+#include "amr-wind/equation_systems/SchemeTraits.H"
+#include "AMReX_BoxList.H"
+
+namespace amr_wind_tests {
+namespace {
+
+//! Tilted liquid slab that only spans part of the domain in x
+void init_vof(amr_wind::Field& vof)
+{
+    const auto& geom = vof.repo().mesh().Geom();
+    run_algorithm(vof, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto& bx = mfi.validbox();
+        const auto& problo = geom[lev].ProbLoArray();
+        const auto& dx = geom[lev].CellSizeArray();
+        const auto& varr = vof(lev).array(mfi);
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+            const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+            const amrex::Real zlo = 0.15 + 0.05 * x;
+            const amrex::Real zhi = 0.85 - 0.05 * x;
+            const amrex::Real fz = amrex::min(
+                (z - zlo) / dx[2] + 0.5, (zhi - z) / dx[2] + 0.5);
+            const amrex::Real fx = amrex::min(
+                (x - 0.05) / dx[0] + 0.5, (0.6 - x) / dx[0] + 0.5);
+            varr(i, j, k) = amrex::min(amrex::max(fz, 0.0), 1.0) *
+                            amrex::min(amrex::max(fx, 0.0), 1.0);
+        });
+    });
+    vof.fillpatch(0.0);
+}
+
+void set_velocity(amr_wind::Field& mac, const amrex::Real val)
+{
+    for (int lev = 0; lev < mac.repo().num_active_levels(); ++lev) {
+        mac(lev).setVal(val);
+    }
+}
+
+} // namespace
+
+class VOFNarrowBandTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{32, 32, 32}};
+            pp.add("max_level", 0);
+            pp.add("max_grid_size", 16);
+            pp.addarr("n_cell", ncell);
+        }
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<amrex::Real> problo{{0.0, 0.0, 0.0}};
+            amrex::Vector<amrex::Real> probhi{{1.0, 1.0, 1.0}};
+            amrex::Vector<int> periodic{{1, 1, 1}};
+            pp.addarr("prob_lo", problo);
+            pp.addarr("prob_hi", probhi);
+            pp.addarr("is_periodic", periodic);
+        }
+        {
+            amrex::ParmParse pp("incflo");
+            amrex::Vector<std::string> physics{"MultiPhase"};
+            pp.addarr("physics", physics);
+            pp.add("use_godunov", (int)1);
+        }
+        {
+            amrex::ParmParse pp("VOF");
+            pp.add("remove_debris", 0);
+        }
+    }
+};
+
+TEST_F(VOFNarrowBandTest, matches_full_reconstruction)
+{
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& pde_mgr = sim().pde_manager();
+    pde_mgr.register_icns();
+    sim().init_physics();
+
+    auto& vof = repo.get_field("vof");
+    auto& seqn = pde_mgr(
+        amr_wind::pde::VOF::pde_name() + "-" +
+        amr_wind::fvm::Godunov::scheme_name());
+    seqn.initialize();
+
+    auto& umac = repo.get_field("u_mac");
+    auto& vmac = repo.get_field("v_mac");
+    auto& wmac = repo.get_field("w_mac");
+    set_velocity(umac, 1.0);
+    set_velocity(vmac, -0.5);
+    set_velocity(wmac, 0.7);
+    const amrex::Real dt = 0.4 / 32.0;
+
+    init_vof(vof);
+
+    // Blocks of every kind are present in the initial condition, the boxes
+    // are larger than the blocks classified by the narrow band
+    int counts[3] = {0, 0, 0};
+    for (amrex::MFIter mfi(vof(0)); mfi.isValid(); ++mfi) {
+        amrex::BoxList blocks(mfi.validbox());
+        blocks.maxSize(amr_wind::multiphase::narrow_band_block_size);
+        EXPECT_GT(blocks.size(), 1);
+        for (const auto& sbx : blocks) {
+            const auto content = amr_wind::multiphase::phase_content(
+                amrex::grow(sbx, 1), vof(0).const_array(mfi));
+            ++counts[static_cast<int>(content)];
+        }
+    }
+    amrex::ParallelDescriptor::ReduceIntSum(counts, 3);
+    EXPECT_GT(counts[0], 0);
+    EXPECT_GT(counts[1], 0);
+    EXPECT_GT(counts[2], 0);
+
+    auto& aa_x = repo.get_field("advalpha_x");
+    auto& aa_y = repo.get_field("advalpha_y");
+    auto& aa_z = repo.get_field("advalpha_z");
+    auto flux_x = repo.create_scratch_field(1, 0, amr_wind::FieldLoc::XFACE);
+    auto flux_y = repo.create_scratch_field(1, 0, amr_wind::FieldLoc::YFACE);
+    auto flux_z = repo.create_scratch_field(1, 0, amr_wind::FieldLoc::ZFACE);
+    auto fluxC = repo.create_scratch_field(1, 0, amr_wind::FieldLoc::CELL);
+    amrex::Vector<amrex::Array<amrex::MultiFab*, AMREX_SPACEDIM>> fluxes(1);
+    amrex::Vector<amrex::Array<amrex::MultiFab*, AMREX_SPACEDIM>> advas(1);
+    fluxes[0][0] = &(*flux_x)(0);
+    fluxes[0][1] = &(*flux_y)(0);
+    fluxes[0][2] = &(*flux_z)(0);
+    advas[0][0] = &aa_x(0);
+    advas[0][1] = &aa_y(0);
+    advas[0][2] = &aa_z(0);
+
+    auto advect = [&](const bool narrow_band) {
+        init_vof(vof);
+        for (int isweep = 1; isweep <= 3; ++isweep) {
+            for (int iorder = 0; iorder < 3; ++iorder) {
+                amr_wind::multiphase::split_advection_step(
+                    isweep, iorder, 1, vof, fluxes, *fluxC, advas, umac,
+                    vmac, wmac, vof.bc_type(), mesh().Geom(), dt, false,
+                    narrow_band);
+            }
+        }
+    };
+
+    advect(false);
+    amrex::MultiFab ref(
+        vof(0).boxArray(), vof(0).DistributionMap(), 1, vof.num_grow());
+    amrex::MultiFab::Copy(ref, vof(0), 0, 0, 1, vof.num_grow());
+
+    advect(true);
+    amrex::MultiFab::Subtract(ref, vof(0), 0, 0, 1, 0);
+    EXPECT_EQ(ref.norminf(0, 1, amrex::IntVect(0)), 0.0);
+}
+
+} // namespace amr_wind_tests
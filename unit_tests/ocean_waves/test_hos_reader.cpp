@@ -0,0 +1,113 @@
+#include "gtest/gtest.h"
+#include "amr-wind/ocean_waves/relaxation_zones/HOSReader.H"
+
+#include <cstdio>
+#include <fstream>
+
+namespace amr_wind_tests {
+
+namespace {
+
+void write_test_txt(const std::string& fname, amrex::Real factor)
+{
+    std::ofstream os(fname);
+    os << "HOS Time = 1.25\n";
+    os << "HOS dt = 0.5\n";
+    os << "nx = 4, Lx = 10.0\n";
+    os << "ny = 3, Ly = 1.0\n";
+    os << "nz = 2, zmin = -1.0, zmax = 0.5\n";
+    os << "key\n";
+    for (int ilat = 0; ilat < 4 * 3; ++ilat) {
+        os << factor * ilat << std::endl;
+        for (int k = 0; k < 2; ++k) {
+            os << factor * (ilat + 0.1 * k) << " "
+               << factor * (ilat + 0.2 * k) << " "
+               << factor * (ilat + 0.3 * k) << std::endl;
+        }
+    }
+}
+
+void check_snapshot(
+    const amr_wind::ocean_waves::HOSSnapshot& snap, amrex::Real factor)
+{
+    constexpr amrex::Real tol = 1.0e-12;
+    EXPECT_NEAR(snap.t, 1.25, tol);
+    EXPECT_NEAR(snap.dt, 0.5, tol);
+    EXPECT_EQ(snap.nx, 4);
+    EXPECT_EQ(snap.ny, 3);
+    EXPECT_EQ(snap.nz, 2);
+    EXPECT_NEAR(snap.Lx, 10.0, tol);
+    EXPECT_NEAR(snap.Ly, 1.0, tol);
+    EXPECT_NEAR(snap.zmin, -1.0, tol);
+    EXPECT_NEAR(snap.zmax, 0.5, tol);
+    ASSERT_EQ(snap.eta.size(), 12);
+    ASSERT_EQ(snap.u.size(), 24);
+    for (int ilat = 0; ilat < 12; ++ilat) {
+        EXPECT_NEAR(snap.eta[ilat], factor * ilat, tol);
+        for (int k = 0; k < 2; ++k) {
+            const int idx = ilat * 2 + k;
+            EXPECT_NEAR(snap.u[idx], factor * (ilat + 0.1 * k), tol);
+            EXPECT_NEAR(snap.v[idx], factor * (ilat + 0.2 * k), tol);
+            EXPECT_NEAR(snap.w[idx], factor * (ilat + 0.3 * k), tol);
+        }
+    }
+}
+
+} // namespace
+
+TEST(HOSReader, text_binary_roundtrip)
+{
+    namespace hos = amr_wind::ocean_waves::hos;
+    const auto txt = hos::filename("HOSTest", 0, 0, hos::FileFormat::text);
+    const auto bin = hos::filename("HOSTest", 0, 0, hos::FileFormat::binary);
+    EXPECT_EQ(txt, "HOSTest_lev0_0.txt");
+    EXPECT_EQ(bin, "HOSTest_lev0_0.bin");
+
+    write_test_txt(txt, 1.0);
+    amr_wind::ocean_waves::HOSSnapshot snap;
+    hos::read_text(txt, snap);
+    check_snapshot(snap, 1.0);
+
+    hos::write_binary(bin, snap);
+    amr_wind::ocean_waves::HOSSnapshot snap_bin;
+    hos::read_binary(bin, snap_bin);
+    check_snapshot(snap_bin, 1.0);
+
+    std::remove(txt.c_str());
+    std::remove(bin.c_str());
+}
+
+TEST(HOSReader, prefetch)
+{
+    namespace hos = amr_wind::ocean_waves::hos;
+    const std::string prefix = "HOSPrefetch";
+    for (int n = 0; n < 2; ++n) {
+        write_test_txt(
+            hos::filename(prefix, 0, n, hos::FileFormat::text), 1.0 + n);
+    }
+
+    amr_wind::ocean_waves::HOSReader reader(
+        prefix, hos::FileFormat::text, true);
+    amr_wind::ocean_waves::HOSSnapshot snap;
+    reader.read(0, 0, snap);
+    check_snapshot(snap, 1.0);
+
+    // Prefetch data and request it, including a file that does not exist
+    reader.prefetch(1, 1);
+    reader.read(0, 1, snap);
+    check_snapshot(snap, 2.0);
+    reader.prefetch(1, 2);
+
+    // Data modified after the prefetch must be read again
+    reader.prefetch(1, 0);
+    write_test_txt(hos::filename(prefix, 0, 0, hos::FileFormat::text), 3.0);
+    reader.read(0, 0, snap);
+    check_snapshot(snap, 3.0);
+
+    for (int n = 0; n < 2; ++n) {
+        std::remove(
+            hos::filename(prefix, 0, n, hos::FileFormat::text).c_str());
+    }
+}
+
+} // namespace amr_wind_tests
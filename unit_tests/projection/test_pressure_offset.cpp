@@ -189,4 +189,37 @@ TEST_F(ProjPerturb, full_p_perturb)
     ptest_kernel(m_rho_0, 0.0, -m_Fg, (m_nx + 1) * (m_ny + 1), m_Fg);
 }
 
+TEST_F(ProjPerturb, persistent_projector)
+{
+    // High-level setup
+    populate_parameters();
+    {
+        amrex::ParmParse pp("incflo");
+        pp.add("persistent_nodal_projector", true);
+        pp.add("nodal_projector_warm_start", true);
+    }
+
+    incflo my_incflo;
+    my_incflo.init_mesh();
+    auto& density = my_incflo.sim().repo().get_field("density");
+    auto& velocity = my_incflo.sim().repo().get_field("velocity");
+    auto& p = my_incflo.sim().repo().get_field("p");
+    density.setVal(m_rho_0);
+    const int nbottom = (m_nx + 1) * (m_ny + 1);
+
+    // The first projection builds the projector
+    const amrex::Real time = 1.0;
+    init_vel_z(velocity, m_Fg);
+    my_incflo.ApplyProjection(density.vec_const_ptrs(), time, 1.0, false);
+    EXPECT_NEAR(-m_Fg, get_pbottom(p) / nbottom, 1e-8);
+
+    // The second projection reuses it with a different timestep size, starting
+    // from the previous pressure. The pressure gradient from the first
+    // projection is added back to the velocity before projecting.
+    const amrex::Real dt = 0.5;
+    init_vel_z(velocity, m_Fg);
+    my_incflo.ApplyProjection(density.vec_const_ptrs(), time, dt, false);
+    EXPECT_NEAR(-m_Fg * (1.0 + dt) / dt, get_pbottom(p) / nbottom, 1e-8);
+}
+
 } // namespace amr_wind_tests
@@ -0,0 +1,150 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/utilities/AABBTree.H"
+#include "amr-wind/utilities/tagging/GeometryRefinement.H"
+
+#include <random>
+
+namespace amr_wind_tests {
+
+namespace {
+
+amrex::RealBox
+make_box(const amrex::Real x, const amrex::Real y, const amrex::Real len)
+{
+    return amrex::RealBox(
+        AMREX_D_DECL(x, y, 0.0), AMREX_D_DECL(x + len, y + len, len));
+}
+
+} // namespace
+
+class AABBTreeTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{32, 32, 16}};
+            pp.addarr("n_cell", ncell);
+            pp.add("max_grid_size", 8);
+        }
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<amrex::Real> probhi{{16.0, 16.0, 8.0}};
+            pp.addarr("prob_hi", probhi);
+        }
+    }
+};
+
+TEST_F(AABBTreeTest, query)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<amrex::Real> pos(0.0, 100.0);
+    std::uniform_real_distribution<amrex::Real> len(0.5, 5.0);
+
+    amrex::Vector<amrex::RealBox> boxes;
+    for (int i = 0; i < 200; ++i) {
+        boxes.push_back(make_box(pos(gen), pos(gen), len(gen)));
+    }
+    amr_wind::utils::AABBTree tree(boxes);
+    EXPECT_EQ(tree.size(), 200);
+    EXPECT_GT(tree.num_nodes(), 1);
+
+    amrex::Vector<int> found;
+    for (int n = 0; n < 50; ++n) {
+        const auto bx = make_box(pos(gen), pos(gen), 10.0);
+        tree.query(bx, found);
+
+        amrex::Vector<int> expected;
+        for (int i = 0; i < boxes.size(); ++i) {
+            if (boxes[i].intersects(bx)) {
+                expected.push_back(i);
+            }
+        }
+        EXPECT_EQ(found, expected);
+    }
+
+    amr_wind::utils::AABBTree empty_tree;
+    empty_tree.query(make_box(0.0, 0.0, 1.0), found);
+    EXPECT_TRUE(found.empty());
+}
+
+TEST_F(AABBTreeTest, geometry_refinement)
+{
+    initialize_mesh();
+    sim().repo().declare_field("velocity", 3);
+
+    // Row of vertical cylinders
+    amrex::Vector<std::string> shapes;
+    for (int i = 0; i < 6; ++i) {
+        const std::string name = "c" + std::to_string(i);
+        shapes.push_back(name);
+        amrex::ParmParse pp("tagging.g1." + name);
+        const amrex::Real xc = 1.5 + 2.5 * i;
+        amrex::Vector<amrex::Real> start{{xc, 4.0, 1.0}};
+        amrex::Vector<amrex::Real> end{{xc, 4.0, 5.0}};
+        pp.add("type", std::string("cylinder"));
+        pp.addarr("start", start);
+        pp.addarr("end", end);
+        pp.add("outer_radius", 1.0);
+    }
+    {
+        amrex::ParmParse pp("tagging.g1");
+        pp.addarr("shapes", shapes);
+    }
+
+    amr_wind::GeometryRefinement refine(sim());
+    refine.initialize("tagging.g1");
+
+    const auto& geom = mesh().Geom(0);
+    const auto& ba = mesh().boxArray(0);
+    const auto& dm = mesh().DistributionMap(0);
+
+    // Reference tags evaluating every shape on every box
+    amrex::TagBoxArray ref_tags(ba, dm);
+    ref_tags.setVal(amrex::TagBox::CLEAR);
+    for (const auto& name : shapes) {
+        auto shape = amr_wind::tagging::GeometryType::create(
+            "cylinder", sim(), "tagging.g1." + name);
+        for (amrex::MFIter mfi(ref_tags); mfi.isValid(); ++mfi) {
+            (*shape)(mfi.validbox(), geom, ref_tags.array(mfi));
+        }
+    }
+
+    // Second call reuses the cached tags
+    for (int n = 0; n < 2; ++n) {
+        amrex::TagBoxArray tags(ba, dm);
+        tags.setVal(amrex::TagBox::CLEAR);
+        refine(0, tags, 0.0, 0);
+
+        int nset = amrex::ReduceSum(
+            ref_tags, 0,
+            [=] AMREX_GPU_HOST_DEVICE(
+                amrex::Box const& bx,
+                amrex::Array4<char const> const& tarr) -> int {
+                int count = 0;
+                amrex::Loop(bx, [=, &count](int i, int j, int k) noexcept {
+                    count += (tarr(i, j, k) == amrex::TagBox::SET) ? 1 : 0;
+                });
+                return count;
+            });
+        int ndiff = amrex::ReduceSum(
+            tags, ref_tags, 0,
+            [=] AMREX_GPU_HOST_DEVICE(
+                amrex::Box const& bx, amrex::Array4<char const> const& t1,
+                amrex::Array4<char const> const& t2) -> int {
+                int count = 0;
+                amrex::Loop(bx, [=, &count](int i, int j, int k) noexcept {
+                    count += (t1(i, j, k) != t2(i, j, k)) ? 1 : 0;
+                });
+                return count;
+            });
+        amrex::ParallelDescriptor::ReduceIntSum(nset);
+        amrex::ParallelDescriptor::ReduceIntSum(ndiff);
+        EXPECT_GT(nset, 0);
+        EXPECT_EQ(ndiff, 0);
+    }
+}
+
+} // namespace amr_wind_tests
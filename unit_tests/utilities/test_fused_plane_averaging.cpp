@@ -0,0 +1,143 @@
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/iter_tools.H"
+
+#include "amr-wind/utilities/FieldPlaneAveraging.H"
+#include "amr-wind/utilities/SecondMomentAveraging.H"
+#include "amr-wind/utilities/ThirdMomentAveraging.H"
+#include "amr-wind/utilities/FusedPlaneAveraging.H"
+#include "amr-wind/utilities/trig_ops.H"
+
+namespace amr_wind_tests {
+
+class FusedPlaneAveragingTest : public MeshTest
+{
+public:
+    void test_dir(int /*dir*/);
+};
+
+namespace {
+
+void init_fields(
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> a,
+    const amrex::Geometry& geom,
+    const amrex::Box& bx,
+    const amrex::Array4<amrex::Real>& velocity,
+    const amrex::Array4<amrex::Real>& temperature)
+{
+    auto xlo = geom.ProbLoArray();
+    auto dx = geom.CellSizeArray();
+
+    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+        amrex::Real x[3];
+
+        x[0] = xlo[0] + (i + 0.5) * dx[0];
+        x[1] = xlo[1] + (j + 0.5) * dx[1];
+        x[2] = xlo[2] + (k + 0.5) * dx[2];
+
+        velocity(i, j, k, 0) = 2.3 + x[2];
+        velocity(i, j, k, 1) = 3.5;
+        velocity(i, j, k, 2) = 0.0;
+        temperature(i, j, k, 0) = 300.0;
+        for (int d = 0; d < 3; ++d) {
+            velocity(i, j, k, 0) += std::cos(a[d] * x[d]);
+            velocity(i, j, k, 1) += std::sin(a[d] * x[d]);
+            velocity(i, j, k, 2) += std::sin(a[d] * x[d]) * cos(a[d] * x[d]);
+            temperature(i, j, k, 0) += std::cos(a[d] * x[d]) *
+                                       std::cos(a[d] * x[d]) *
+                                       std::sin(a[d] * x[d]);
+        }
+    });
+}
+
+} // namespace
+
+void FusedPlaneAveragingTest::test_dir(int dir)
+{
+    constexpr double tol = 1.0e-10;
+
+    populate_parameters();
+    initialize_mesh();
+
+    auto& frepo = mesh().field_repo();
+    auto& velocityf = frepo.declare_field("velocity", 3);
+    auto& temperaturef = frepo.declare_field("temperature", 1);
+    auto velocity = velocityf.vec_ptrs();
+    auto temperature = temperaturef.vec_ptrs();
+
+    constexpr int periods = 3;
+    const auto& problo = mesh().Geom(0).ProbLoArray();
+    const auto& probhi = mesh().Geom(0).ProbHiArray();
+
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> a;
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        a[d] = periods * amr_wind::utils::two_pi() / (probhi[d] - problo[d]);
+    }
+
+    run_algorithm(
+        mesh().num_levels(), velocity,
+        [&](const int lev, const amrex::MFIter& mfi) {
+            auto vel = velocity[lev]->array(mfi);
+            auto temp = temperature[lev]->array(mfi);
+            const auto& bx = mfi.validbox();
+            init_fields(a, mesh().Geom(lev), bx, vel, temp);
+        });
+
+    // Reference values from the individual operators
+    amr_wind::FieldPlaneAveraging pa_u(velocityf, sim().time(), dir);
+    amr_wind::FieldPlaneAveraging pa_t(temperaturef, sim().time(), dir);
+    pa_u();
+    pa_t();
+    amr_wind::SecondMomentAveraging uu(pa_u, pa_u);
+    amr_wind::SecondMomentAveraging tu(pa_u, pa_t);
+    amr_wind::ThirdMomentAveraging uuu(pa_u, pa_u, pa_u);
+    uu();
+    tu();
+    uuu();
+
+    amr_wind::FieldPlaneAveraging fpa_u(velocityf, sim().time(), dir);
+    amr_wind::FieldPlaneAveraging fpa_t(temperaturef, sim().time(), dir);
+    amr_wind::SecondMomentAveraging fuu(fpa_u, fpa_u);
+    amr_wind::SecondMomentAveraging ftu(fpa_u, fpa_t);
+    amr_wind::ThirdMomentAveraging fuuu(fpa_u, fpa_u, fpa_u);
+
+    amr_wind::FusedPlaneAveraging fused(dir);
+    fused.add(fpa_u);
+    fused.add(fpa_t);
+    fused.add(fuu);
+    fused.add(ftu);
+    fused.add(fuuu);
+
+    // Second call exercises the moments about the shifted averages
+    for (int n = 0; n < 2; ++n) {
+        fused();
+
+        const auto& ref_u = pa_u.line_average();
+        const auto& fused_u = fpa_u.line_average();
+        ASSERT_EQ(ref_u.size(), fused_u.size());
+        for (size_t i = 0; i < ref_u.size(); ++i) {
+            EXPECT_NEAR(ref_u[i], fused_u[i], tol);
+        }
+
+        const auto& ref_t = pa_t.line_average();
+        const auto& fused_t = fpa_t.line_average();
+        for (size_t i = 0; i < ref_t.size(); ++i) {
+            EXPECT_NEAR(ref_t[i], fused_t[i], tol);
+        }
+
+        for (size_t i = 0; i < uu.line_moment().size(); ++i) {
+            EXPECT_NEAR(uu.line_moment()[i], fuu.line_moment()[i], tol);
+        }
+        for (size_t i = 0; i < tu.line_moment().size(); ++i) {
+            EXPECT_NEAR(tu.line_moment()[i], ftu.line_moment()[i], tol);
+        }
+        for (size_t i = 0; i < uuu.line_moment().size(); ++i) {
+            EXPECT_NEAR(uuu.line_moment()[i], fuuu.line_moment()[i], tol);
+        }
+    }
+}
+
+TEST_F(FusedPlaneAveragingTest, test_xdir) { test_dir(0); }
+TEST_F(FusedPlaneAveragingTest, test_ydir) { test_dir(1); }
+TEST_F(FusedPlaneAveragingTest, test_zdir) { test_dir(2); }
+
+} // namespace amr_wind_tests
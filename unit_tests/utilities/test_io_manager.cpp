@@ -0,0 +1,133 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/utilities/IOManager.H"
+
+#include "AMReX_AsyncOut.H"
+#include "AMReX_PlotFileUtil.H"
+#include "AMReX_Utility.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+void init_data(amrex::MultiFab& mf)
+{
+    for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+        const auto& arr = mf.array(mfi);
+        amrex::ParallelFor(
+            mfi.validbox(), mf.nComp(),
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) {
+                arr(i, j, k, n) = 100.0 * n + 10.0 * i + j + 0.1 * k;
+            });
+    }
+}
+
+/** Turn on the AMReX asynchronous output thread for the scope of a test
+ *
+ *  AMReX reads amrex.async_out once during initialization, so the output
+ *  thread is restarted here and switched off again on exit.
+ */
+class AsyncOutScope
+{
+public:
+    AsyncOutScope() { restart(1); }
+
+    ~AsyncOutScope() { restart(0); }
+
+    AsyncOutScope(const AsyncOutScope&) = delete;
+    AsyncOutScope& operator=(const AsyncOutScope&) = delete;
+
+private:
+    static void restart(const int async_out)
+    {
+        amrex::AsyncOut::Finalize();
+        amrex::ParmParse pp("amrex");
+        pp.add("async_out", async_out);
+        amrex::AsyncOut::Initialize();
+    }
+};
+
+} // namespace
+
+class IOManagerTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("amr");
+            pp.add("max_grid_size", 4);
+        }
+        {
+            amrex::ParmParse pp("io");
+            pp.add("async_output", true);
+            // Smaller than a single file, every write waits for the previous
+            pp.add("async_max_pending_mb", 1.0e-3);
+            pp.add("plot_file", std::string("async_io_plt"));
+            pp.add("check_file", std::string("async_io_chk"));
+        }
+    }
+};
+
+TEST_F(IOManagerTest, async_checkpoint_roundtrip)
+{
+    AsyncOutScope async_scope;
+    ASSERT_TRUE(amrex::AsyncOut::UseAsyncOut());
+
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& fld = repo.declare_field("async_io_field", 3, 1);
+    const int nlevels = repo.num_active_levels();
+    fld.setVal(0.0);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        init_data(fld(lev));
+    }
+
+    amr_wind::IOManager io(sim());
+    io.register_io_var(fld.name());
+    io.initialize_io();
+    ASSERT_TRUE(io.async_output());
+
+    io.write_plot_file();
+    io.write_checkpoint_file();
+
+    // The data was staged during the calls, changes made while it is being
+    // written must not show up in the files
+    fld.setVal(-1.0);
+
+    io.wait_for_output();
+    EXPECT_EQ(io.pending_output_bytes(), 0);
+
+    const std::string pltname = amrex::Concatenate("async_io_plt", 0);
+    const std::string chkname = amrex::Concatenate("async_io_chk", 0);
+    EXPECT_TRUE(amrex::FileExists(pltname + "/Header"));
+    EXPECT_TRUE(amrex::FileExists(pltname + "/amr_wind_info"));
+    EXPECT_TRUE(amrex::FileExists(chkname + "/Header"));
+    EXPECT_TRUE(amrex::FileExists(chkname + "/amr_wind_info"));
+
+    amrex::Vector<amrex::BoxArray> ba_chk(nlevels);
+    amrex::Vector<amrex::DistributionMapping> dm_chk(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        ba_chk[lev] = mesh().boxArray(lev);
+        dm_chk[lev] = mesh().DistributionMap(lev);
+    }
+    io.read_checkpoint_fields(chkname, ba_chk, dm_chk, amrex::IntVect(1));
+
+    auto expected = repo.create_scratch_field(fld.num_comp());
+    for (int lev = 0; lev < nlevels; ++lev) {
+        (*expected)(lev).setVal(0.0);
+        init_data((*expected)(lev));
+        amrex::MultiFab::Subtract(
+            (*expected)(lev), fld(lev), 0, 0, fld.num_comp(), 0);
+        EXPECT_EQ((*expected)(lev).norminf(0, fld.num_comp(), 0), 0.0);
+    }
+
+    // Further output still works once the pending files are flushed
+    fld.setVal(2.0);
+    io.write_checkpoint_file();
+    io.wait_for_output();
+    EXPECT_EQ(io.pending_output_bytes(), 0);
+}
+
+} // namespace amr_wind_tests
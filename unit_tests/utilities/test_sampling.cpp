@@ -51,6 +51,9 @@ public:
 
     bool write_flag{false};
 
+    //! Sampled values of the first variable gathered on the I/O processor
+    std::vector<double> first_var;
+
 protected:
     void prepare_netcdf_file() override {}
     void process_output() override
@@ -59,6 +62,7 @@ protected:
         std::vector<double> buf(
             num_total_particles() * var_names().size(), 0.0);
         sampling_container().populate_buffer(buf);
+        first_var.assign(buf.begin(), buf.begin() + num_total_particles());
 
         write_flag = true;
     }
@@ -224,6 +228,15 @@ TEST_F(SamplingTest, sampling)
     probes.post_advance_work();
 
     EXPECT_TRUE(probes.write_flag);
+
+    // Linear density field is interpolated exactly along the line
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        ASSERT_EQ(probes.first_var.size(), 16U);
+        for (int i = 0; i < 16; ++i) {
+            const amrex::Real z = 1.0 + i * 126.0 / 15.0;
+            EXPECT_NEAR(probes.first_var[i], 132.0 + z, 1.0e-10);
+        }
+    }
 }
 
 TEST_F(SamplingTest, sampling_timing)
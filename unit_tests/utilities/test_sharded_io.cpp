@@ -0,0 +1,97 @@
+#include "aw_test_utils/AmrexTest.H"
+#include "amr-wind/utilities/ShardedMultiFabIO.H"
+
+#include <cmath>
+#include <random>
+
+#include "AMReX_Utility.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+void init_field(amrex::MultiFab& mf)
+{
+    for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+        const auto& arr = mf.array(mfi);
+        amrex::ParallelFor(
+            mfi.validbox(), mf.nComp(),
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) {
+                arr(i, j, k, n) = std::sin(0.3 * i + n) * std::cos(0.2 * j) +
+                                  0.01 * k;
+            });
+    }
+}
+
+} // namespace
+
+class ShardedIOTest : public AmrexTest
+{};
+
+TEST_F(ShardedIOTest, compress_roundtrip)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<amrex::Real> dist(-1.0, 1.0);
+    std::vector<amrex::Real> data(1000);
+    for (int i = 0; i < 300; ++i) {
+        data[i] = dist(gen);
+    }
+    for (int i = 300; i < 600; ++i) {
+        data[i] = 0.0;
+    }
+    for (int i = 600; i < 1000; ++i) {
+        data[i] = std::sin(0.01 * i);
+    }
+
+    const auto buf = amr_wind::ioutils::compress(data.data(), data.size());
+    std::vector<amrex::Real> out(data.size(), -1.0);
+    amr_wind::ioutils::decompress(
+        buf.data(), buf.size(), out.data(), out.size());
+    for (int i = 0; i < data.size(); ++i) {
+        EXPECT_EQ(data[i], out[i]);
+    }
+    EXPECT_LT(buf.size(), data.size() * sizeof(amrex::Real));
+}
+
+TEST_F(ShardedIOTest, write_read_redistributed)
+{
+    const std::string dirname = "sharded_io_test";
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        amrex::UtilCreateCleanDirectory(dirname, false);
+    }
+    amrex::ParallelDescriptor::Barrier();
+
+    const amrex::Box domain(
+        amrex::IntVect(0), amrex::IntVect(AMREX_D_DECL(31, 15, 7)));
+    const int ncomp = 3;
+    amrex::BoxArray ba_src(domain);
+    ba_src.maxSize(8);
+    amrex::MultiFab src(ba_src, amrex::DistributionMapping(ba_src), ncomp, 1);
+    src.setVal(0.0);
+    init_field(src);
+
+    const std::string prefix = dirname + "/field";
+    for (const bool compress : {true, false}) {
+        amr_wind::ioutils::write_sharded(src, prefix, 2, compress);
+        amrex::ParallelDescriptor::Barrier();
+        ASSERT_TRUE(amr_wind::ioutils::sharded_exists(prefix));
+
+        // Different grids and distribution than the stored data
+        amrex::BoxArray ba_dst(domain);
+        ba_dst.maxSize(amrex::IntVect(AMREX_D_DECL(16, 4, 8)));
+        amrex::MultiFab dst(
+            ba_dst, amrex::DistributionMapping(ba_dst), ncomp, 1);
+        dst.setVal(-1.0);
+        amr_wind::ioutils::read_sharded(dst, prefix);
+
+        amrex::MultiFab expected(
+            ba_dst, amrex::DistributionMapping(ba_dst), ncomp, 1);
+        expected.setVal(0.0);
+        init_field(expected);
+        amrex::MultiFab::Subtract(dst, expected, 0, 0, ncomp, 0);
+        EXPECT_EQ(dst.norminf(0, ncomp, 0), 0.0);
+    }
+    EXPECT_FALSE(amr_wind::ioutils::sharded_exists(dirname + "/missing"));
+}
+
+} // namespace amr_wind_tests
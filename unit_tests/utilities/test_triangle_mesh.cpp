@@ -0,0 +1,231 @@
+#include "aw_test_utils/AmrexTest.H"
+#include "amr-wind/utilities/TriangleMesh.H"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+#include "AMReX_FArrayBox.H"
+#include "AMReX_IArrayBox.H"
+#include "AMReX_ParallelDescriptor.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+namespace vs = amr_wind::vs;
+using Triangle = amr_wind::utils::TriangleMesh::Triangle;
+
+//! Triangulated surface of the cube [lo, hi]^3, faces are split along the
+//! diagonals
+amrex::Vector<Triangle>
+cube_triangles(const amrex::Real lo, const amrex::Real hi)
+{
+    amrex::Vector<Triangle> tris;
+    for (int d = 0; d < 3; ++d) {
+        const int a = (d + 1) % 3;
+        const int b = (d + 2) % 3;
+        for (const amrex::Real side : {lo, hi}) {
+            amrex::Array<vs::Vector, 4> quad;
+            for (int n = 0; n < 4; ++n) {
+                quad[n][d] = side;
+                quad[n][a] = ((n == 1) || (n == 2)) ? hi : lo;
+                quad[n][b] = (n >= 2) ? hi : lo;
+            }
+            tris.push_back({quad[0], quad[1], quad[2]});
+            tris.push_back({quad[0], quad[2], quad[3]});
+        }
+    }
+    return tris;
+}
+
+//! Exact signed distance to the cube [lo, hi]^3
+amrex::Real cube_distance(
+    const amrex::Real x,
+    const amrex::Real y,
+    const amrex::Real z,
+    const amrex::Real lo,
+    const amrex::Real hi)
+{
+    const amrex::Real c = 0.5 * (lo + hi);
+    const amrex::Real h = 0.5 * (hi - lo);
+    const amrex::Real qx = std::abs(x - c) - h;
+    const amrex::Real qy = std::abs(y - c) - h;
+    const amrex::Real qz = std::abs(z - c) - h;
+    const amrex::Real out = std::sqrt(
+        std::pow(amrex::max(qx, 0.0), 2) + std::pow(amrex::max(qy, 0.0), 2) +
+        std::pow(amrex::max(qz, 0.0), 2));
+    return out + amrex::min(amrex::max(qx, amrex::max(qy, qz)), 0.0);
+}
+
+void write_ascii_stl(
+    const std::string& fname, const amrex::Vector<Triangle>& tris)
+{
+    std::ofstream os(fname);
+    os << "solid cube\n";
+    for (const auto& tri : tris) {
+        os << "  facet normal 0 0 0\n    outer loop\n";
+        for (const auto& vtx : tri) {
+            os << "      vertex " << vtx.x() << " " << vtx.y() << " "
+               << vtx.z() << "\n";
+        }
+        os << "    endloop\n  endfacet\n";
+    }
+    os << "endsolid cube\n";
+}
+
+void write_binary_stl(
+    const std::string& fname, const amrex::Vector<Triangle>& tris)
+{
+    std::ofstream os(fname, std::ios::binary);
+    // Header starting with "solid" like some exporters do
+    char header[80] = "solid cube";
+    os.write(header, sizeof(header));
+    const auto ntri = static_cast<std::uint32_t>(tris.size());
+    os.write(reinterpret_cast<const char*>(&ntri), sizeof(ntri));
+    for (const auto& tri : tris) {
+        float xyz[12] = {0.0};
+        for (int iv = 0; iv < 3; ++iv) {
+            for (int d = 0; d < 3; ++d) {
+                xyz[3 + 3 * iv + d] = static_cast<float>(tri[iv][d]);
+            }
+        }
+        const std::uint16_t attr = 0;
+        os.write(reinterpret_cast<const char*>(xyz), sizeof(xyz));
+        os.write(reinterpret_cast<const char*>(&attr), sizeof(attr));
+    }
+}
+
+void write_obj(const std::string& fname)
+{
+    std::ofstream os(fname);
+    os << "# Unit cube\n";
+    for (int n = 0; n < 8; ++n) {
+        os << "v " << (n % 2) << " " << ((n / 2) % 2) << " " << (n / 4)
+           << "\n";
+    }
+    os << "f 1 3 7 5\n";
+    os << "f 2/2 4/4 8/8 6/6\n";
+    os << "f 1//1 2//2 6//6 5//5\n";
+    os << "f 3 4 8 7\n";
+    os << "f 1 2 4 3\n";
+    os << "f -4 -3 -1 -2\n";
+}
+
+} // namespace
+
+class TriangleMeshTest : public AmrexTest
+{};
+
+TEST_F(TriangleMeshTest, contains)
+{
+    amr_wind::utils::TriangleMesh mesh;
+    mesh.define(cube_triangles(0.2, 0.7));
+    EXPECT_EQ(mesh.num_triangles(), 12);
+    EXPECT_NEAR(mesh.bounding_box().lo(0), 0.2, 1.0e-12);
+    EXPECT_NEAR(mesh.bounding_box().hi(2), 0.7, 1.0e-12);
+
+    EXPECT_TRUE(mesh.contains(vs::Vector(0.3, 0.4, 0.5)));
+    EXPECT_FALSE(mesh.contains(vs::Vector(0.1, 0.4, 0.5)));
+    EXPECT_FALSE(mesh.contains(vs::Vector(0.8, 0.4, 0.5)));
+    EXPECT_FALSE(mesh.contains(vs::Vector(0.3, 0.9, 0.5)));
+
+    // Lines through the nodes with j == k cross the diagonal edges of the
+    // faces normal to x, which must be counted exactly once
+    const int nn = 16;
+    const amrex::Box bx(
+        amrex::IntVect(0), amrex::IntVect(nn), amrex::IndexType::TheNodeType());
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> problo{0.0, 0.0, 0.0};
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx{
+        1.0 / nn, 1.0 / nn, 1.0 / nn};
+    amrex::IArrayBox inside(bx, 1, amrex::The_Pinned_Arena());
+    mesh.contains(bx, problo, dx, inside.array());
+
+    const auto& arr = inside.const_array();
+    int nerr = 0;
+    amrex::Loop(bx, [=, &nerr](int i, int j, int k) noexcept {
+        const bool expected = (i * dx[0] > 0.2) && (i * dx[0] < 0.7) &&
+                              (j * dx[1] > 0.2) && (j * dx[1] < 0.7) &&
+                              (k * dx[2] > 0.2) && (k * dx[2] < 0.7);
+        if ((arr(i, j, k) != 0) != expected) {
+            ++nerr;
+        }
+    });
+    EXPECT_EQ(nerr, 0);
+}
+
+TEST_F(TriangleMeshTest, signed_distance)
+{
+    constexpr amrex::Real tol = 1.0e-12;
+    amr_wind::utils::TriangleMesh mesh;
+    mesh.define(cube_triangles(0.0, 1.0));
+    mesh.transform(0.5, vs::Vector(0.25, 0.25, 0.25));
+
+    EXPECT_NEAR(mesh.distance(vs::Vector(0.5, 0.5, 0.9), 0.5), 0.15, tol);
+    EXPECT_NEAR(
+        mesh.distance(vs::Vector(0.9, 0.9, 0.5), 0.5), std::sqrt(0.045), tol);
+    EXPECT_NEAR(mesh.distance(vs::Vector(0.5, 0.5, 0.5), 0.5), 0.25, tol);
+    EXPECT_NEAR(mesh.distance(vs::Vector(0.5, 0.5, 0.5), 0.1), 0.1, tol);
+
+    const int nn = 24;
+    const amrex::Box bx(amrex::IntVect(0), amrex::IntVect(nn - 1));
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> problo{0.0, 0.0, 0.0};
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx{
+        1.0 / nn, 1.0 / nn, 1.0 / nn};
+    const amrex::Real band = 3.0 * dx[0];
+    amrex::FArrayBox phi(bx, 1, amrex::The_Pinned_Arena());
+    mesh.signed_distance(bx, problo, dx, band, phi.array());
+
+    // Exact distances in the band, clipped values with the right sign
+    // elsewhere
+    const auto& arr = phi.const_array();
+    int nerr = 0;
+    amrex::Loop(bx, [=, &nerr](int i, int j, int k) noexcept {
+        const amrex::Real exact = cube_distance(
+            (i + 0.5) * dx[0], (j + 0.5) * dx[1], (k + 0.5) * dx[2], 0.25,
+            0.75);
+        const amrex::Real expected =
+            amrex::max(-band, amrex::min(band, exact));
+        if (std::abs(arr(i, j, k) - expected) > tol) {
+            ++nerr;
+        }
+    });
+    EXPECT_EQ(nerr, 0);
+}
+
+TEST_F(TriangleMeshTest, read_files)
+{
+    const auto tris = cube_triangles(0.0, 1.0);
+    const std::string ascii_stl = "triangle_mesh_ascii.stl";
+    const std::string binary_stl = "triangle_mesh_binary.STL";
+    const std::string obj = "triangle_mesh.obj";
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        write_ascii_stl(ascii_stl, tris);
+        write_binary_stl(binary_stl, tris);
+        write_obj(obj);
+    }
+    amrex::ParallelDescriptor::Barrier();
+
+    for (const auto& fname : {ascii_stl, binary_stl, obj}) {
+        amr_wind::utils::TriangleMesh mesh;
+        mesh.read(fname);
+        EXPECT_EQ(mesh.num_triangles(), 12);
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            EXPECT_NEAR(mesh.bounding_box().lo(d), 0.0, 1.0e-12);
+            EXPECT_NEAR(mesh.bounding_box().hi(d), 1.0, 1.0e-12);
+        }
+        EXPECT_TRUE(mesh.contains(vs::Vector(0.3, 0.6, 0.5)));
+        EXPECT_FALSE(mesh.contains(vs::Vector(1.3, 0.6, 0.5)));
+        EXPECT_NEAR(
+            mesh.distance(vs::Vector(0.5, 0.5, 1.5), 1.0), 0.5, 1.0e-12);
+    }
+
+    amrex::ParallelDescriptor::Barrier();
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::remove(ascii_stl.c_str());
+        std::remove(binary_stl.c_str());
+        std::remove(obj.c_str());
+    }
+}
+
+} // namespace amr_wind_tests
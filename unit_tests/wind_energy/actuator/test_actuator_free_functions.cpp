@@ -100,5 +100,26 @@ TEST(CylindricalTransformation, distances_on_rotated_shifted_circle)
     EXPECT_DOUBLE_EQ(1.0, d[2]);
 }
 
+TEST(GaussianSupport, support_box_bounds_rotated_gaussian)
+{
+    const vs::Vector pos{1.0, 2.0, 3.0};
+    const vs::Vector eps{0.5, 2.0, 1.0};
+
+    const auto rbx = act::gaussian_support_box(pos, eps);
+    const amrex::Real rad = act::gaussian_cutoff * 2.0;
+    EXPECT_DOUBLE_EQ(rbx.lo(0), pos.x() - rad);
+    EXPECT_DOUBLE_EQ(rbx.hi(2), pos.z() + rad);
+
+    // Gaussian is zero outside the support box for arbitrary orientation
+    const auto tmat = vs::quaternion(vs::Vector{1.0, 1.0, 0.0}, 37.0);
+    const vs::Vector outside{pos.x() + 1.01 * rad, pos.y(), pos.z()};
+    EXPECT_DOUBLE_EQ(act::gaussian3d(tmat & (outside - pos), eps), 0.0);
+    EXPECT_FALSE(rbx.contains(outside.data()));
+
+    const vs::Vector inside{pos.x(), pos.y() + 0.5, pos.z()};
+    EXPECT_GT(act::gaussian3d(tmat & (inside - pos), eps), 0.0);
+    EXPECT_TRUE(rbx.contains(inside.data()));
+}
+
 } // namespace
 } // namespace amr_wind_tests::amr_wind
@@ -46,11 +46,13 @@ protected:
             pp.addarr("prob_hi", probhi);
         }
     }
+
+    void check_act_container(bool sparse_gather);
 };
 
 } // namespace
 
-TEST_F(ActuatorTest, act_container)
+void ActuatorTest::check_act_container(bool sparse_gather)
 {
     const int nprocs = amrex::ParallelDescriptor::NProcs();
     if (nprocs > 2) {
@@ -70,6 +72,7 @@ TEST_F(ActuatorTest, act_container)
     const int num_nodes = 16;
 
     TestActContainer ac(mesh(), num_turbines);
+    ac.use_sparse_gather(sparse_gather);
     auto& data = ac.get_data_obj();
 
     for (int it = 0; it < num_turbines; ++it) {
@@ -168,4 +171,11 @@ TEST_F(ActuatorTest, act_container)
     }
 }
 
+TEST_F(ActuatorTest, act_container) { check_act_container(true); }
+
+TEST_F(ActuatorTest, act_container_global_gather)
+{
+    check_act_container(false);
+}
+
 } // namespace amr_wind_tests
@@ -122,6 +122,46 @@ TYPED_TEST(ActTurbineFastTest, test_ops)
 #endif
 }
 
+TYPED_TEST(ActTurbineFastTest, lag_forces_bookkeeping)
+{
+    namespace act = ::amr_wind::actuator;
+    using act::ops::FastAdvance;
+    MeshTest::initialize_mesh();
+    {
+        amrex::ParmParse pp("Actuator.TurbineFast" + TypeParam::identifier());
+        pp.add("openfast_lag_forces", true);
+    }
+    act::utils::ActParser pp(
+        "Actuator.TurbineFast" + TypeParam::identifier(), "Actuator.T1");
+    act::ActDataHolder<act::TurbineFast> data(MeshTest::sim(), "T1", 0);
+    {
+        using ReadOp = act::ops::ReadInputsOp<act::TurbineFast, TypeParam>;
+        ReadOp op;
+        op(data, pp);
+    }
+
+    // Lagged forces do not imply concurrent calls to OpenFAST
+    auto& meta = data.meta();
+    EXPECT_TRUE(meta.fast_lag_forces);
+    EXPECT_FALSE(meta.fast_concurrent);
+
+    // The initial solution is always computed before the forces are needed
+    EXPECT_TRUE(meta.fast_data.is_solution0);
+    EXPECT_EQ(act::ops::fast_advance_mode(meta), FastAdvance::init);
+
+    // Afterwards, OpenFAST advances while the next CFD step proceeds
+    meta.fast_data.is_solution0 = false;
+    EXPECT_EQ(act::ops::fast_advance_mode(meta), FastAdvance::lagged);
+    meta.fast_concurrent = true;
+    EXPECT_EQ(act::ops::fast_advance_mode(meta), FastAdvance::lagged);
+
+    // Without lag, forces are computed from the current step
+    meta.fast_lag_forces = false;
+    EXPECT_EQ(act::ops::fast_advance_mode(meta), FastAdvance::concurrent);
+    meta.fast_concurrent = false;
+    EXPECT_EQ(act::ops::fast_advance_mode(meta), FastAdvance::serial);
+}
+
 TYPED_TEST(ActTurbineFastTest, fast_turbine)
 {
     MeshTest::initialize_mesh();
@@ -173,6 +173,125 @@ TEST_F(ABLMeshTest, abl_local_wall_model)
     EXPECT_NEAR(vexpct, vbase, tol);
 }
 
+TEST_F(ABLMeshTest, abl_local_mo_wall_model)
+{
+    constexpr amrex::Real tol = 1.0e-12;
+    constexpr amrex::Real mu = 0.01;
+    constexpr amrex::Real vval = 5.0;
+    constexpr amrex::Real dt = 0.1;
+    constexpr amrex::Real kappa = 0.4;
+    constexpr amrex::Real z0 = 0.11;
+    constexpr amrex::Real z0_patch = 0.01;
+    int dir = 0;
+    populate_parameters();
+    {
+        amrex::ParmParse pp("geometry");
+        amrex::Vector<int> periodic{{1, 1, 0}};
+        pp.addarr("is_periodic", periodic);
+    }
+    {
+        amrex::ParmParse pp("zlo");
+        pp.add("type", (std::string) "wall_model");
+    }
+    {
+        amrex::ParmParse pp("zhi");
+        pp.add("type", (std::string) "slip_wall");
+    }
+    {
+        amrex::ParmParse pp("incflo");
+        pp.add("diffusion_type", 0);
+    }
+    {
+        amrex::ParmParse pp("transport");
+        pp.add("viscosity", mu);
+    }
+    {
+        amrex::ParmParse pp("time");
+        pp.add("fixed_dt", dt);
+    }
+    {
+        amrex::ParmParse pp("ABL");
+        pp.add("wall_shear_stress_type", (std::string) "local_mo");
+        pp.add("kappa", kappa);
+        pp.add("surface_roughness_z0", z0);
+        amrex::Vector<std::string> patches{"smooth"};
+        pp.addarr("surface_patches", patches);
+    }
+    {
+        // Smoother surface over the lower half of the domain in x
+        amrex::ParmParse pp("ABL.surface_patch.smooth");
+        amrex::Vector<amrex::Real> lo{{0.0, 0.0}};
+        amrex::Vector<amrex::Real> hi{{60.0, 120.0}};
+        pp.addarr("lo", lo);
+        pp.addarr("hi", hi);
+        pp.add("surface_roughness_z0", z0_patch);
+    }
+    initialize_mesh();
+
+    // Set up solver-related routines
+    auto& pde_mgr = sim().pde_manager();
+    pde_mgr.register_icns();
+    sim().create_turbulence_model();
+    sim().init_physics();
+
+    // Specify velocity as uniform in x direction
+    auto& velocity = sim().repo().get_field("velocity");
+    init_velocity(velocity, vval, dir);
+    // Specify density as unity
+    auto& density = sim().repo().get_field("density");
+    density.setVal(1.0);
+    auto& temperature = sim().repo().get_field("temperature");
+    temperature.setVal(300.0);
+    // Perform post init for physics: turns on wall model
+    for (auto& pp : sim().physics()) {
+        pp->post_init_actions();
+    }
+
+    // Advance states to prepare for time step
+    pde_mgr.advance_states();
+
+    // Initialize icns pde
+    auto& icns_eq = pde_mgr.icns();
+    icns_eq.initialize();
+    // Initialize viscosity
+    sim().turbulence_model().update_turbulent_viscosity(
+        amr_wind::FieldState::Old, DiffusionType::Crank_Nicolson);
+    icns_eq.compute_mueff(amr_wind::FieldState::Old);
+
+    // Check test setup by verifying mu
+    const auto& viscosity = sim().repo().get_field("velocity_mueff");
+    EXPECT_NEAR(mu, utils::field_max(viscosity), tol);
+    EXPECT_NEAR(mu, utils::field_min(viscosity), tol);
+
+    // Zero source term and convection term to focus on diffusion
+    auto& src = icns_eq.fields().src_term;
+    auto& adv = icns_eq.fields().conv_term;
+    src.setVal(0.0);
+    adv.setVal(0.0);
+
+    // Calculate diffusion term
+    icns_eq.compute_diffusion_term(amr_wind::FieldState::Old);
+    // Setup mask_cell array to avoid errors in solve
+    auto& mask_cell = sim().repo().declare_int_field("mask_cell", 1, 1);
+    mask_cell.setVal(1);
+    // Compute result with just diffusion term
+    icns_eq.compute_predictor_rhs(DiffusionType::Explicit);
+
+    // Get resulting velocity in first cell
+    const amrex::Real vbase = get_val_at_kindex(velocity, dir, 0) / 8 / 8;
+
+    // Calculate expected velocity after one step
+    const amrex::Real dz = sim().mesh().Geom(0).CellSizeArray()[2];
+    const amrex::Real zref = 0.5 * dz;
+    const amrex::Real utau = kappa * vval / (std::log(zref / z0));
+    const amrex::Real utau_patch = kappa * vval / (std::log(zref / z0_patch));
+    // Half of the wall faces are within the patch
+    const amrex::Real tau_wall =
+        0.5 * (std::pow(utau, 2) + std::pow(utau_patch, 2));
+    const amrex::Real vexpct = vval + dt * (0.0 - tau_wall) / dz;
+    EXPECT_NEAR(vexpct, vbase, tol);
+}
+
 TEST_F(ABLMeshTest, abl_donelan_wall_model)
 {
     constexpr amrex::Real tol = 1.0e-12;
@@ -0,0 +1,174 @@
+#include "abl_test_utils.H"
+#include "amr-wind/wind_energy/MOSurfaceLayer.H"
+
+#include "AMReX_Gpu.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+//! Solve the surface layer equations at the given points on device
+amrex::Vector<amr_wind::MOFaceFlux> solve_points(
+    const amr_wind::MOSurfaceLayerView& mo,
+    const amrex::Vector<amrex::Real>& xy,
+    const amrex::Real zref,
+    const amrex::Real wspd,
+    const amrex::Real theta)
+{
+    const int npts = static_cast<int>(xy.size()) / 2;
+    amrex::Gpu::DeviceVector<amrex::Real> xy_d(xy.size());
+    amrex::Gpu::DeviceVector<amr_wind::MOFaceFlux> flux_d(npts);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, xy.begin(), xy.end(), xy_d.begin());
+
+    const auto* xy_ptr = xy_d.data();
+    auto* flux_ptr = flux_d.data();
+    amrex::ParallelFor(npts, [=] AMREX_GPU_DEVICE(int i) noexcept {
+        flux_ptr[i] =
+            mo.solve(xy_ptr[2 * i], xy_ptr[2 * i + 1], zref, wspd, theta);
+    });
+
+    amrex::Vector<amr_wind::MOFaceFlux> flux(npts);
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, flux_d.begin(), flux_d.end(), flux.begin());
+    return flux;
+}
+
+//! Evaluate the stability functions psi_m and psi_h on device
+amrex::Vector<amrex::Real> eval_psi(
+    const amr_wind::MOSurfaceLayerView& mo,
+    const amrex::Vector<amrex::Real>& zeta)
+{
+    const int npts = static_cast<int>(zeta.size());
+    amrex::Gpu::DeviceVector<amrex::Real> zeta_d(npts);
+    amrex::Gpu::DeviceVector<amrex::Real> psi_d(2 * npts);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, zeta.begin(), zeta.end(), zeta_d.begin());
+
+    const auto* zeta_ptr = zeta_d.data();
+    auto* psi_ptr = psi_d.data();
+    amrex::ParallelFor(npts, [=] AMREX_GPU_DEVICE(int i) noexcept {
+        psi_ptr[2 * i] = mo.psi_m(zeta_ptr[i]);
+        psi_ptr[2 * i + 1] = mo.psi_h(zeta_ptr[i]);
+    });
+
+    amrex::Vector<amrex::Real> psi(2 * npts);
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, psi_d.begin(), psi_d.end(), psi.begin());
+    return psi;
+}
+
+} // namespace
+
+TEST_F(ABLTest, mo_surface_layer_matches_modata)
+{
+    {
+        amrex::ParmParse pp("ABL");
+        pp.add("mo_num_iterations", 40);
+    }
+
+    // Unstable and stable surface heat fluxes
+    for (const amrex::Real q : {0.1, -0.01}) {
+        amr_wind::MOData mo;
+        mo.zref = 5.0;
+        mo.z0 = 0.1;
+        mo.vmag_mean = 8.0;
+        mo.theta_mean = 300.0;
+        mo.surf_temp_flux = q;
+        mo.alg_type = amr_wind::MOData::ThetaCalcType::HEAT_FLUX;
+        mo.update_fluxes();
+
+        amr_wind::MOSurfaceLayer local_mo;
+        local_mo.read_inputs("ABL", mo);
+        const auto flux = solve_points(
+            local_mo.view(mo), {0.0, 0.0}, mo.zref, mo.vmag_mean,
+            mo.theta_mean);
+
+        EXPECT_NEAR(flux[0].utau, mo.utau, 1.0e-4);
+        EXPECT_NEAR(flux[0].surf_temp, mo.surf_temp, 1.0e-3);
+        EXPECT_NEAR(flux[0].surf_temp_flux, q, 1.0e-12);
+    }
+}
+
+TEST_F(ABLTest, mo_surface_layer_lookup_table)
+{
+    amr_wind::MOData mo;
+    mo.z0 = 0.05;
+    mo.surf_temp = 310.0;
+    mo.alg_type = amr_wind::MOData::ThetaCalcType::SURFACE_TEMPERATURE;
+
+    amr_wind::MOSurfaceLayer direct;
+    direct.read_inputs("ABL", mo);
+    {
+        amrex::ParmParse pp("ABL");
+        pp.add("mo_lookup_table", 1);
+        pp.add("mo_lookup_table_size", 4096);
+    }
+    amr_wind::MOSurfaceLayer tabulated;
+    tabulated.read_inputs("ABL", mo);
+    EXPECT_FALSE(direct.use_lookup_table());
+    EXPECT_TRUE(tabulated.use_lookup_table());
+
+    const amrex::Vector<amrex::Real> zeta{{-9.5, -3.3, -0.7, -0.01}};
+    const auto psi = eval_psi(tabulated.view(mo), zeta);
+    for (int i = 0; i < zeta.size(); ++i) {
+        const amrex::Real psi_m = mo.calc_psi_m(zeta[i]);
+        const amrex::Real psi_h = mo.calc_psi_h(zeta[i]);
+        EXPECT_NEAR(psi[2 * i], psi_m, 1.0e-3 * std::abs(psi_m));
+        EXPECT_NEAR(psi[2 * i + 1], psi_h, 1.0e-3 * std::abs(psi_h));
+    }
+
+    // Convective surface layer: warm surface with a light wind
+    const auto f1 = solve_points(direct.view(mo), {0.0, 0.0}, 10.0, 2.0, 300.0);
+    const auto f2 =
+        solve_points(tabulated.view(mo), {0.0, 0.0}, 10.0, 2.0, 300.0);
+    EXPECT_GT(f1[0].surf_temp_flux, 0.0);
+    EXPECT_NEAR(f1[0].utau, f2[0].utau, 1.0e-3 * f1[0].utau);
+    EXPECT_NEAR(
+        f1[0].surf_temp_flux, f2[0].surf_temp_flux,
+        1.0e-3 * f1[0].surf_temp_flux);
+}
+
+TEST_F(ABLTest, mo_surface_layer_patches)
+{
+    constexpr amrex::Real tol = 1.0e-12;
+    constexpr amrex::Real kappa = 0.41;
+    constexpr amrex::Real zref = 2.0;
+    constexpr amrex::Real wspd = 6.0;
+    {
+        amrex::ParmParse pp("ABL");
+        amrex::Vector<std::string> patches{"water", "island"};
+        pp.addarr("surface_patches", patches);
+    }
+    {
+        amrex::ParmParse pp("ABL.surface_patch.water");
+        pp.addarr("lo", amrex::Vector<amrex::Real>{0.0, 0.0});
+        pp.addarr("hi", amrex::Vector<amrex::Real>{100.0, 100.0});
+        pp.add("surface_roughness_z0", 0.001);
+    }
+    {
+        amrex::ParmParse pp("ABL.surface_patch.island");
+        pp.addarr("lo", amrex::Vector<amrex::Real>{40.0, 40.0});
+        pp.addarr("hi", amrex::Vector<amrex::Real>{60.0, 60.0});
+        pp.add("surface_roughness_z0", 0.5);
+    }
+
+    amr_wind::MOData mo;
+    mo.kappa = kappa;
+    mo.z0 = 0.1;
+    amr_wind::MOSurfaceLayer local_mo;
+    local_mo.read_inputs("ABL", mo);
+    EXPECT_EQ(local_mo.num_patches(), 2);
+
+    // Outside all patches, inside "water", inside the overlapping "island"
+    const auto flux = solve_points(
+        local_mo.view(mo), {150.0, 10.0, 10.0, 10.0, 50.0, 50.0}, zref, wspd,
+        300.0);
+
+    // Neutral conditions reduce to the log law
+    EXPECT_NEAR(flux[0].utau, kappa * wspd / std::log(zref / 0.1), tol);
+    EXPECT_NEAR(flux[1].utau, kappa * wspd / std::log(zref / 0.001), tol);
+    EXPECT_NEAR(flux[2].utau, kappa * wspd / std::log(zref / 0.5), tol);
+}
+
+} // namespace amr_wind_tests
@@ -0,0 +1,135 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/physics/SyntheticTurbulence.H"
+
+namespace amr_wind_tests {
+
+class SynthTurbTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+        {
+            amrex::ParmParse pp("SynthTurb");
+            amrex::Vector<int> box_dims{{16, 8, 8}};
+            amrex::Vector<amrex::Real> box_len{{16.0, 6.0, 6.0}};
+            amrex::Vector<amrex::Real> location{{4.0, 4.0, 4.0}};
+            amrex::Vector<amrex::Real> sigma{{1.0, 0.8, 0.5}};
+            pp.add("generator", std::string("spectral"));
+            pp.addarr("box_dims", box_dims);
+            pp.addarr("box_lengths", box_len);
+            pp.addarr("grid_location", location);
+            pp.addarr("sigma", sigma);
+            pp.add("length_scale", 2.0);
+            pp.add("num_modes", 64);
+            pp.add("seed", 3);
+            pp.add("mean_wind_type", std::string("ConstValue"));
+            pp.add("gauss_smearing_factor", 1.0);
+        }
+        {
+            amrex::ParmParse pp("ConstValue.velocity");
+            amrex::Vector<amrex::Real> vel{{1.0, 0.0, 0.0}};
+            pp.addarr("value", vel);
+        }
+    }
+
+    //! Compute the forcing with a new generator at the given times
+    void compute_forcing(const amrex::Vector<amrex::Real>& times)
+    {
+        amr_wind::SyntheticTurbulence synth_turb(sim());
+        for (const auto tt : times) {
+            time().set_restart_time(0, tt);
+            synth_turb.pre_advance_work();
+        }
+    }
+};
+
+TEST_F(SynthTurbTest, spectral_generator)
+{
+    initialize_mesh();
+    auto& repo = sim().repo();
+    repo.declare_field("velocity", 3);
+    auto& density = repo.declare_field("density", 1);
+    auto& turb_force = repo.declare_field("synth_turb_forcing", 3);
+    density.setVal(1.0);
+
+    // Advance through two planes, the second call reuses the right plane
+    turb_force.setVal(0.0);
+    compute_forcing({2.5, 3.5});
+    amrex::MultiFab ref(
+        turb_force(0).boxArray(), turb_force(0).DistributionMap(), 3, 0);
+    amrex::MultiFab::Copy(ref, turb_force(0), 0, 0, 3, 0);
+
+    // No forcing outside of the turbulence box (y < 1 or y > 7)
+    auto sum_force = [&](const bool in_box) {
+        amrex::Real total = amrex::ReduceSum(
+            turb_force(0), 0,
+            [=] AMREX_GPU_HOST_DEVICE(
+                amrex::Box const& bx,
+                amrex::Array4<amrex::Real const> const& farr) -> amrex::Real {
+                amrex::Real fsum = 0.0;
+                amrex::Loop(bx, [=, &fsum](int i, int j, int k) noexcept {
+                    if (((j > 0) && (j < 7)) == in_box) {
+                        fsum += std::abs(farr(i, j, k, 0)) +
+                                std::abs(farr(i, j, k, 1)) +
+                                std::abs(farr(i, j, k, 2));
+                    }
+                });
+                return fsum;
+            });
+        amrex::ParallelDescriptor::ReduceRealSum(total);
+        return total;
+    };
+    const amrex::Real outside = sum_force(false);
+    const amrex::Real inside = sum_force(true);
+    EXPECT_NEAR(outside, 0.0, 1.0e-15);
+    EXPECT_GT(inside, 0.0);
+
+    // A new generator (e.g., after a restart) reproduces the same planes
+    turb_force.setVal(0.0);
+    compute_forcing({3.5});
+    amrex::MultiFab::Subtract(ref, turb_force(0), 0, 0, 3, 0);
+    EXPECT_NEAR(ref.norm0(0), 0.0, 1.0e-12);
+    EXPECT_NEAR(ref.norm0(1), 0.0, 1.0e-12);
+    EXPECT_NEAR(ref.norm0(2), 0.0, 1.0e-12);
+}
+
+TEST_F(SynthTurbTest, spectral_modes_solenoidal)
+{
+    initialize_mesh();
+    auto& repo = sim().repo();
+    repo.declare_field("velocity", 3);
+    repo.declare_field("density", 1);
+    repo.declare_field("synth_turb_forcing", 3);
+
+    amr_wind::SyntheticTurbulence synth_turb(sim());
+    const auto& modes = synth_turb.spectral_modes();
+    const int num_modes = static_cast<int>(modes.wavenum.size());
+    ASSERT_EQ(num_modes, 64);
+    amrex::Vector<amr_wind::vs::Vector> wavenum(num_modes);
+    amrex::Vector<amr_wind::vs::Vector> amplitude(num_modes);
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, modes.wavenum.begin(), modes.wavenum.end(),
+        wavenum.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, modes.amplitude.begin(),
+        modes.amplitude.end(), amplitude.begin());
+
+    // Every mode is divergence-free with the anisotropic sigma and the total
+    // energy matches the requested standard deviations
+    const amrex::Real two_pi = 2.0 * std::acos(-1.0);
+    amrex::Real energy = 0.0;
+    for (int n = 0; n < num_modes; ++n) {
+        const auto& kvec = wavenum[n];
+        const auto& amp = amplitude[n];
+        const amrex::Real scale =
+            amr_wind::vs::mag(kvec) * amr_wind::vs::mag(amp);
+        EXPECT_NEAR(kvec & amp, 0.0, 1.0e-12 * scale);
+        const amrex::Real nx = kvec[0] * 16.0 / two_pi;
+        EXPECT_NEAR(nx, std::round(nx), 1.0e-10);
+        energy += 0.5 * (amp & amp);
+    }
+    EXPECT_NEAR(energy, 1.0 + 0.8 * 0.8 + 0.5 * 0.5, 1.0e-12);
+}
+
+} // namespace amr_wind_tests